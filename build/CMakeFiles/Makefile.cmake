@@ -0,0 +1,142 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/dtls_client/CMakeLists.txt"
+  "/root/repo/examples/dtls_server/CMakeLists.txt"
+  "/root/repo/examples/http1_http2_server/CMakeLists.txt"
+  "/root/repo/examples/http2_client/CMakeLists.txt"
+  "/root/repo/examples/http2_server/CMakeLists.txt"
+  "/root/repo/examples/http_client/CMakeLists.txt"
+  "/root/repo/examples/http_parse_bench/CMakeLists.txt"
+  "/root/repo/examples/http_server/CMakeLists.txt"
+  "/root/repo/examples/https_server/CMakeLists.txt"
+  "/root/repo/examples/tcp_client/CMakeLists.txt"
+  "/root/repo/examples/tcp_connect_bench/CMakeLists.txt"
+  "/root/repo/examples/tcp_echo_server/CMakeLists.txt"
+  "/root/repo/examples/tcp_server_multi_thread/CMakeLists.txt"
+  "/root/repo/examples/tcp_server_reuse_port/CMakeLists.txt"
+  "/root/repo/examples/tls_client/CMakeLists.txt"
+  "/root/repo/examples/tls_echo_server/CMakeLists.txt"
+  "/root/repo/examples/tls_link.cmake"
+  "/root/repo/examples/udp_conn_client/CMakeLists.txt"
+  "/root/repo/examples/udp_conn_server/CMakeLists.txt"
+  "/root/repo/examples/udp_echo_server/CMakeLists.txt"
+  "/root/repo/examples/udp_sender/CMakeLists.txt"
+  "/root/repo/examples/ws_client/CMakeLists.txt"
+  "/root/repo/examples/ws_server/CMakeLists.txt"
+  "/root/repo/src/common.cmake"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/http/CMakeLists.txt"
+  "/root/repo/src/http2/CMakeLists.txt"
+  "/root/repo/src/net/CMakeLists.txt"
+  "/root/repo/src/tls/CMakeLists.txt"
+  "/root/repo/src/tls_option.cmake"
+  "/root/repo/src/ws/CMakeLists.txt"
+  "/root/repo/src/ws_http2/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/net/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tls/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/http/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/http2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ws/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ws_http2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/http1_http2_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/http2_client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/http2_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/http_client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/http_parse_bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/http_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/https_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tcp_client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tcp_connect_bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tcp_echo_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tcp_server_multi_thread/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tcp_server_reuse_port/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tls_client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tls_echo_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/dtls_client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/dtls_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/udp_echo_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/udp_sender/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/udp_conn_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/udp_conn_client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/ws_client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/ws_server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/core/CMakeFiles/co_core.dir/DependInfo.cmake"
+  "src/net/CMakeFiles/co_net.dir/DependInfo.cmake"
+  "src/tls/CMakeFiles/co_tls.dir/DependInfo.cmake"
+  "src/http/CMakeFiles/co_http.dir/DependInfo.cmake"
+  "src/http2/CMakeFiles/co_http2.dir/DependInfo.cmake"
+  "src/ws/CMakeFiles/co_ws.dir/DependInfo.cmake"
+  "src/ws_http2/CMakeFiles/co_ws_http2.dir/DependInfo.cmake"
+  "examples/http1_http2_server/CMakeFiles/http1_http2_server.dir/DependInfo.cmake"
+  "examples/http2_client/CMakeFiles/http2_client.dir/DependInfo.cmake"
+  "examples/http2_server/CMakeFiles/http2_server.dir/DependInfo.cmake"
+  "examples/http_client/CMakeFiles/http_client.dir/DependInfo.cmake"
+  "examples/http_parse_bench/CMakeFiles/http_parse_bench.dir/DependInfo.cmake"
+  "examples/http_server/CMakeFiles/http_server.dir/DependInfo.cmake"
+  "examples/https_server/CMakeFiles/https_server.dir/DependInfo.cmake"
+  "examples/tcp_client/CMakeFiles/tcp_client.dir/DependInfo.cmake"
+  "examples/tcp_connect_bench/CMakeFiles/tcp_connect_bench.dir/DependInfo.cmake"
+  "examples/tcp_echo_server/CMakeFiles/tcp_echo_server.dir/DependInfo.cmake"
+  "examples/tcp_server_multi_thread/CMakeFiles/tcp_server_multithread.dir/DependInfo.cmake"
+  "examples/tcp_server_reuse_port/CMakeFiles/tcp_server_reuse_port.dir/DependInfo.cmake"
+  "examples/tls_client/CMakeFiles/tls_client.dir/DependInfo.cmake"
+  "examples/tls_echo_server/CMakeFiles/tls_echo_server.dir/DependInfo.cmake"
+  "examples/dtls_client/CMakeFiles/dtls_client.dir/DependInfo.cmake"
+  "examples/dtls_server/CMakeFiles/dtls_server.dir/DependInfo.cmake"
+  "examples/udp_echo_server/CMakeFiles/udp_echo_server.dir/DependInfo.cmake"
+  "examples/udp_sender/CMakeFiles/udp_sender.dir/DependInfo.cmake"
+  "examples/udp_conn_server/CMakeFiles/udp_conn_server.dir/DependInfo.cmake"
+  "examples/udp_conn_client/CMakeFiles/udp_conn_client.dir/DependInfo.cmake"
+  "examples/ws_client/CMakeFiles/ws_client.dir/DependInfo.cmake"
+  "examples/ws_server/CMakeFiles/ws_server.dir/DependInfo.cmake"
+  )
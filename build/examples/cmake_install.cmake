@@ -0,0 +1,71 @@
+# Install script for directory: /root/repo/examples
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/build/examples/http1_http2_server/cmake_install.cmake")
+  include("/root/repo/build/examples/http2_client/cmake_install.cmake")
+  include("/root/repo/build/examples/http2_server/cmake_install.cmake")
+  include("/root/repo/build/examples/http_client/cmake_install.cmake")
+  include("/root/repo/build/examples/http_parse_bench/cmake_install.cmake")
+  include("/root/repo/build/examples/http_server/cmake_install.cmake")
+  include("/root/repo/build/examples/https_server/cmake_install.cmake")
+  include("/root/repo/build/examples/tcp_client/cmake_install.cmake")
+  include("/root/repo/build/examples/tcp_connect_bench/cmake_install.cmake")
+  include("/root/repo/build/examples/tcp_echo_server/cmake_install.cmake")
+  include("/root/repo/build/examples/tcp_server_multi_thread/cmake_install.cmake")
+  include("/root/repo/build/examples/tcp_server_reuse_port/cmake_install.cmake")
+  include("/root/repo/build/examples/tls_client/cmake_install.cmake")
+  include("/root/repo/build/examples/tls_echo_server/cmake_install.cmake")
+  include("/root/repo/build/examples/dtls_client/cmake_install.cmake")
+  include("/root/repo/build/examples/dtls_server/cmake_install.cmake")
+  include("/root/repo/build/examples/udp_echo_server/cmake_install.cmake")
+  include("/root/repo/build/examples/udp_sender/cmake_install.cmake")
+  include("/root/repo/build/examples/udp_conn_server/cmake_install.cmake")
+  include("/root/repo/build/examples/udp_conn_client/cmake_install.cmake")
+  include("/root/repo/build/examples/ws_client/cmake_install.cmake")
+  include("/root/repo/build/examples/ws_server/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtls_client.dir/main.c.o"
+  "CMakeFiles/dtls_client.dir/main.c.o.d"
+  "dtls_client"
+  "dtls_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtls_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
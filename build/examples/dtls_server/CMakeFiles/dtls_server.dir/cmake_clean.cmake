@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtls_server.dir/main.c.o"
+  "CMakeFiles/dtls_server.dir/main.c.o.d"
+  "dtls_server"
+  "dtls_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtls_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
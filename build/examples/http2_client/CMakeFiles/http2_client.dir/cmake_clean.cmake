@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http2_client.dir/main.c.o"
+  "CMakeFiles/http2_client.dir/main.c.o.d"
+  "http2_client"
+  "http2_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/http2_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http2_server.dir/main.c.o"
+  "CMakeFiles/http2_server.dir/main.c.o.d"
+  "http2_server"
+  "http2_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/http2_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_client.dir/main.c.o"
+  "CMakeFiles/http_client.dir/main.c.o.d"
+  "http_client"
+  "http_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/http_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_parse_bench.dir/main.c.o"
+  "CMakeFiles/http_parse_bench.dir/main.c.o.d"
+  "http_parse_bench"
+  "http_parse_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/http_parse_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
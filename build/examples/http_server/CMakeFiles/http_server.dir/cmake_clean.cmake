@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_server.dir/main.c.o"
+  "CMakeFiles/http_server.dir/main.c.o.d"
+  "http_server"
+  "http_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/http_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcp_client.dir/main.c.o"
+  "CMakeFiles/tcp_client.dir/main.c.o.d"
+  "tcp_client"
+  "tcp_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tcp_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcp_connect_bench.dir/main.c.o"
+  "CMakeFiles/tcp_connect_bench.dir/main.c.o.d"
+  "tcp_connect_bench"
+  "tcp_connect_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tcp_connect_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcp_echo_server.dir/main.c.o"
+  "CMakeFiles/tcp_echo_server.dir/main.c.o.d"
+  "tcp_echo_server"
+  "tcp_echo_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tcp_echo_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/tcp_server_multi_thread/main.c" "examples/tcp_server_multi_thread/CMakeFiles/tcp_server_multithread.dir/main.c.o" "gcc" "examples/tcp_server_multi_thread/CMakeFiles/tcp_server_multithread.dir/main.c.o.d"
+  "/root/repo/examples/tcp_server_multi_thread/tcp_client_thread.c" "examples/tcp_server_multi_thread/CMakeFiles/tcp_server_multithread.dir/tcp_client_thread.c.o" "gcc" "examples/tcp_server_multi_thread/CMakeFiles/tcp_server_multithread.dir/tcp_client_thread.c.o.d"
+  "/root/repo/examples/tcp_server_multi_thread/tcp_server_app.c" "examples/tcp_server_multi_thread/CMakeFiles/tcp_server_multithread.dir/tcp_server_app.c.o" "gcc" "examples/tcp_server_multi_thread/CMakeFiles/tcp_server_multithread.dir/tcp_server_app.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
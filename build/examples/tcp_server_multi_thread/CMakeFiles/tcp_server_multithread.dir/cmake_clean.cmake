@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcp_server_multithread.dir/main.c.o"
+  "CMakeFiles/tcp_server_multithread.dir/main.c.o.d"
+  "CMakeFiles/tcp_server_multithread.dir/tcp_client_thread.c.o"
+  "CMakeFiles/tcp_server_multithread.dir/tcp_client_thread.c.o.d"
+  "CMakeFiles/tcp_server_multithread.dir/tcp_server_app.c.o"
+  "CMakeFiles/tcp_server_multithread.dir/tcp_server_app.c.o.d"
+  "tcp_server_multithread"
+  "tcp_server_multithread.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tcp_server_multithread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcp_server_reuse_port.dir/main.c.o"
+  "CMakeFiles/tcp_server_reuse_port.dir/main.c.o.d"
+  "tcp_server_reuse_port"
+  "tcp_server_reuse_port.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tcp_server_reuse_port.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tls_client.dir/main.c.o"
+  "CMakeFiles/tls_client.dir/main.c.o.d"
+  "tls_client"
+  "tls_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tls_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
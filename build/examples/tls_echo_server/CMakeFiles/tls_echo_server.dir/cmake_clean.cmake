@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tls_echo_server.dir/main.c.o"
+  "CMakeFiles/tls_echo_server.dir/main.c.o.d"
+  "tls_echo_server"
+  "tls_echo_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tls_echo_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/udp_conn_server.dir/main.c.o"
+  "CMakeFiles/udp_conn_server.dir/main.c.o.d"
+  "udp_conn_server"
+  "udp_conn_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/udp_conn_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
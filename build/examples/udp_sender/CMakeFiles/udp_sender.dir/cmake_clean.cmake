@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/udp_sender.dir/main.c.o"
+  "CMakeFiles/udp_sender.dir/main.c.o.d"
+  "udp_sender"
+  "udp_sender.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/udp_sender.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ws_client.dir/main.c.o"
+  "CMakeFiles/ws_client.dir/main.c.o.d"
+  "ws_client"
+  "ws_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ws_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ws_server.dir/main.c.o"
+  "CMakeFiles/ws_server.dir/main.c.o.d"
+  "ws_server"
+  "ws_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ws_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
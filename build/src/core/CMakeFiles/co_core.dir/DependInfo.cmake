@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/co.c" "src/core/CMakeFiles/co_core.dir/co.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co.c.o.d"
+  "/root/repo/src/core/co_app.c" "src/core/CMakeFiles/co_core.dir/co_app.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_app.c.o.d"
+  "/root/repo/src/core/co_array.c" "src/core/CMakeFiles/co_core.dir/co_array.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_array.c.o.d"
+  "/root/repo/src/core/co_config.c" "src/core/CMakeFiles/co_core.dir/co_config.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_config.c.o.d"
+  "/root/repo/src/core/co_event.c" "src/core/CMakeFiles/co_core.dir/co_event.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_event.c.o.d"
+  "/root/repo/src/core/co_event_worker.c" "src/core/CMakeFiles/co_core.dir/co_event_worker.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_event_worker.c.o.d"
+  "/root/repo/src/core/co_list.c" "src/core/CMakeFiles/co_core.dir/co_list.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_list.c.o.d"
+  "/root/repo/src/core/co_log.c" "src/core/CMakeFiles/co_core.dir/co_log.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_log.c.o.d"
+  "/root/repo/src/core/co_map.c" "src/core/CMakeFiles/co_core.dir/co_map.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_map.c.o.d"
+  "/root/repo/src/core/co_mem_pool.c" "src/core/CMakeFiles/co_core.dir/co_mem_pool.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_mem_pool.c.o.d"
+  "/root/repo/src/core/co_mutex.c" "src/core/CMakeFiles/co_core.dir/co_mutex.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_mutex.c.o.d"
+  "/root/repo/src/core/co_queue.c" "src/core/CMakeFiles/co_core.dir/co_queue.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_queue.c.o.d"
+  "/root/repo/src/core/co_random.c" "src/core/CMakeFiles/co_core.dir/co_random.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_random.c.o.d"
+  "/root/repo/src/core/co_semaphore.c" "src/core/CMakeFiles/co_core.dir/co_semaphore.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_semaphore.c.o.d"
+  "/root/repo/src/core/co_string.c" "src/core/CMakeFiles/co_core.dir/co_string.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_string.c.o.d"
+  "/root/repo/src/core/co_string_list.c" "src/core/CMakeFiles/co_core.dir/co_string_list.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_string_list.c.o.d"
+  "/root/repo/src/core/co_string_map.c" "src/core/CMakeFiles/co_core.dir/co_string_map.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_string_map.c.o.d"
+  "/root/repo/src/core/co_string_token.c" "src/core/CMakeFiles/co_core.dir/co_string_token.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_string_token.c.o.d"
+  "/root/repo/src/core/co_thread.c" "src/core/CMakeFiles/co_core.dir/co_thread.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_thread.c.o.d"
+  "/root/repo/src/core/co_time.c" "src/core/CMakeFiles/co_core.dir/co_time.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_time.c.o.d"
+  "/root/repo/src/core/co_timer.c" "src/core/CMakeFiles/co_core.dir/co_timer.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_timer.c.o.d"
+  "/root/repo/src/core/co_timer_manager.c" "src/core/CMakeFiles/co_core.dir/co_timer_manager.c.o" "gcc" "src/core/CMakeFiles/co_core.dir/co_timer_manager.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
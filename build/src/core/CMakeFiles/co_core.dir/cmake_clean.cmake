@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/co_core.dir/co.c.o"
+  "CMakeFiles/co_core.dir/co.c.o.d"
+  "CMakeFiles/co_core.dir/co_app.c.o"
+  "CMakeFiles/co_core.dir/co_app.c.o.d"
+  "CMakeFiles/co_core.dir/co_array.c.o"
+  "CMakeFiles/co_core.dir/co_array.c.o.d"
+  "CMakeFiles/co_core.dir/co_config.c.o"
+  "CMakeFiles/co_core.dir/co_config.c.o.d"
+  "CMakeFiles/co_core.dir/co_event.c.o"
+  "CMakeFiles/co_core.dir/co_event.c.o.d"
+  "CMakeFiles/co_core.dir/co_event_worker.c.o"
+  "CMakeFiles/co_core.dir/co_event_worker.c.o.d"
+  "CMakeFiles/co_core.dir/co_list.c.o"
+  "CMakeFiles/co_core.dir/co_list.c.o.d"
+  "CMakeFiles/co_core.dir/co_log.c.o"
+  "CMakeFiles/co_core.dir/co_log.c.o.d"
+  "CMakeFiles/co_core.dir/co_map.c.o"
+  "CMakeFiles/co_core.dir/co_map.c.o.d"
+  "CMakeFiles/co_core.dir/co_mem_pool.c.o"
+  "CMakeFiles/co_core.dir/co_mem_pool.c.o.d"
+  "CMakeFiles/co_core.dir/co_mutex.c.o"
+  "CMakeFiles/co_core.dir/co_mutex.c.o.d"
+  "CMakeFiles/co_core.dir/co_queue.c.o"
+  "CMakeFiles/co_core.dir/co_queue.c.o.d"
+  "CMakeFiles/co_core.dir/co_random.c.o"
+  "CMakeFiles/co_core.dir/co_random.c.o.d"
+  "CMakeFiles/co_core.dir/co_semaphore.c.o"
+  "CMakeFiles/co_core.dir/co_semaphore.c.o.d"
+  "CMakeFiles/co_core.dir/co_string.c.o"
+  "CMakeFiles/co_core.dir/co_string.c.o.d"
+  "CMakeFiles/co_core.dir/co_string_list.c.o"
+  "CMakeFiles/co_core.dir/co_string_list.c.o.d"
+  "CMakeFiles/co_core.dir/co_string_map.c.o"
+  "CMakeFiles/co_core.dir/co_string_map.c.o.d"
+  "CMakeFiles/co_core.dir/co_string_token.c.o"
+  "CMakeFiles/co_core.dir/co_string_token.c.o.d"
+  "CMakeFiles/co_core.dir/co_thread.c.o"
+  "CMakeFiles/co_core.dir/co_thread.c.o.d"
+  "CMakeFiles/co_core.dir/co_time.c.o"
+  "CMakeFiles/co_core.dir/co_time.c.o.d"
+  "CMakeFiles/co_core.dir/co_timer.c.o"
+  "CMakeFiles/co_core.dir/co_timer.c.o.d"
+  "CMakeFiles/co_core.dir/co_timer_manager.c.o"
+  "CMakeFiles/co_core.dir/co_timer_manager.c.o.d"
+  "libco_core.a"
+  "libco_core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/co_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
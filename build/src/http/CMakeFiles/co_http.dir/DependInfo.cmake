@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/http/co_base64.c" "src/http/CMakeFiles/co_http.dir/co_base64.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_base64.c.o.d"
+  "/root/repo/src/http/co_http.c" "src/http/CMakeFiles/co_http.dir/co_http.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http.c.o.d"
+  "/root/repo/src/http/co_http_auth.c" "src/http/CMakeFiles/co_http.dir/co_http_auth.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_auth.c.o.d"
+  "/root/repo/src/http/co_http_client.c" "src/http/CMakeFiles/co_http.dir/co_http_client.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_client.c.o.d"
+  "/root/repo/src/http/co_http_config.c" "src/http/CMakeFiles/co_http.dir/co_http_config.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_config.c.o.d"
+  "/root/repo/src/http/co_http_connection.c" "src/http/CMakeFiles/co_http.dir/co_http_connection.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_connection.c.o.d"
+  "/root/repo/src/http/co_http_content_receiver.c" "src/http/CMakeFiles/co_http.dir/co_http_content_receiver.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_content_receiver.c.o.d"
+  "/root/repo/src/http/co_http_cookie.c" "src/http/CMakeFiles/co_http.dir/co_http_cookie.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_cookie.c.o.d"
+  "/root/repo/src/http/co_http_file.c" "src/http/CMakeFiles/co_http.dir/co_http_file.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_file.c.o.d"
+  "/root/repo/src/http/co_http_header.c" "src/http/CMakeFiles/co_http.dir/co_http_header.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_header.c.o.d"
+  "/root/repo/src/http/co_http_log.c" "src/http/CMakeFiles/co_http.dir/co_http_log.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_log.c.o.d"
+  "/root/repo/src/http/co_http_message.c" "src/http/CMakeFiles/co_http.dir/co_http_message.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_message.c.o.d"
+  "/root/repo/src/http/co_http_pool.c" "src/http/CMakeFiles/co_http.dir/co_http_pool.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_pool.c.o.d"
+  "/root/repo/src/http/co_http_request.c" "src/http/CMakeFiles/co_http.dir/co_http_request.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_request.c.o.d"
+  "/root/repo/src/http/co_http_response.c" "src/http/CMakeFiles/co_http.dir/co_http_response.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_response.c.o.d"
+  "/root/repo/src/http/co_http_response_template.c" "src/http/CMakeFiles/co_http.dir/co_http_response_template.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_response_template.c.o.d"
+  "/root/repo/src/http/co_http_scan.c" "src/http/CMakeFiles/co_http.dir/co_http_scan.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_scan.c.o.d"
+  "/root/repo/src/http/co_http_server.c" "src/http/CMakeFiles/co_http.dir/co_http_server.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_server.c.o.d"
+  "/root/repo/src/http/co_http_sync.c" "src/http/CMakeFiles/co_http.dir/co_http_sync.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_sync.c.o.d"
+  "/root/repo/src/http/co_http_tcp_extension.c" "src/http/CMakeFiles/co_http.dir/co_http_tcp_extension.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_http_tcp_extension.c.o.d"
+  "/root/repo/src/http/co_md5.c" "src/http/CMakeFiles/co_http.dir/co_md5.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_md5.c.o.d"
+  "/root/repo/src/http/co_sha1.c" "src/http/CMakeFiles/co_http.dir/co_sha1.c.o" "gcc" "src/http/CMakeFiles/co_http.dir/co_sha1.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
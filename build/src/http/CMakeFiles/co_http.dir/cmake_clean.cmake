@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/co_http.dir/co_base64.c.o"
+  "CMakeFiles/co_http.dir/co_base64.c.o.d"
+  "CMakeFiles/co_http.dir/co_http.c.o"
+  "CMakeFiles/co_http.dir/co_http.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_auth.c.o"
+  "CMakeFiles/co_http.dir/co_http_auth.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_client.c.o"
+  "CMakeFiles/co_http.dir/co_http_client.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_config.c.o"
+  "CMakeFiles/co_http.dir/co_http_config.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_connection.c.o"
+  "CMakeFiles/co_http.dir/co_http_connection.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_content_receiver.c.o"
+  "CMakeFiles/co_http.dir/co_http_content_receiver.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_cookie.c.o"
+  "CMakeFiles/co_http.dir/co_http_cookie.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_file.c.o"
+  "CMakeFiles/co_http.dir/co_http_file.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_header.c.o"
+  "CMakeFiles/co_http.dir/co_http_header.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_log.c.o"
+  "CMakeFiles/co_http.dir/co_http_log.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_message.c.o"
+  "CMakeFiles/co_http.dir/co_http_message.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_pool.c.o"
+  "CMakeFiles/co_http.dir/co_http_pool.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_request.c.o"
+  "CMakeFiles/co_http.dir/co_http_request.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_response.c.o"
+  "CMakeFiles/co_http.dir/co_http_response.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_response_template.c.o"
+  "CMakeFiles/co_http.dir/co_http_response_template.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_scan.c.o"
+  "CMakeFiles/co_http.dir/co_http_scan.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_server.c.o"
+  "CMakeFiles/co_http.dir/co_http_server.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_sync.c.o"
+  "CMakeFiles/co_http.dir/co_http_sync.c.o.d"
+  "CMakeFiles/co_http.dir/co_http_tcp_extension.c.o"
+  "CMakeFiles/co_http.dir/co_http_tcp_extension.c.o.d"
+  "CMakeFiles/co_http.dir/co_md5.c.o"
+  "CMakeFiles/co_http.dir/co_md5.c.o.d"
+  "CMakeFiles/co_http.dir/co_sha1.c.o"
+  "CMakeFiles/co_http.dir/co_sha1.c.o.d"
+  "libco_http.a"
+  "libco_http.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/co_http.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
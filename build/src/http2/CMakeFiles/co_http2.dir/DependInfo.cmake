@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/http2/co_http2.c" "src/http2/CMakeFiles/co_http2.dir/co_http2.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2.c.o.d"
+  "/root/repo/src/http2/co_http2_client.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_client.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_client.c.o.d"
+  "/root/repo/src/http2/co_http2_frame.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_frame.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_frame.c.o.d"
+  "/root/repo/src/http2/co_http2_header.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_header.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_header.c.o.d"
+  "/root/repo/src/http2/co_http2_hpack.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_hpack.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_hpack.c.o.d"
+  "/root/repo/src/http2/co_http2_http_extension.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_http_extension.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_http_extension.c.o.d"
+  "/root/repo/src/http2/co_http2_huffman.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_huffman.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_huffman.c.o.d"
+  "/root/repo/src/http2/co_http2_log.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_log.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_log.c.o.d"
+  "/root/repo/src/http2/co_http2_server.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_server.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_server.c.o.d"
+  "/root/repo/src/http2/co_http2_stream.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_stream.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_stream.c.o.d"
+  "/root/repo/src/http2/co_http2_tcp_extension.c" "src/http2/CMakeFiles/co_http2.dir/co_http2_tcp_extension.c.o" "gcc" "src/http2/CMakeFiles/co_http2.dir/co_http2_tcp_extension.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/co_http2.dir/co_http2.c.o"
+  "CMakeFiles/co_http2.dir/co_http2.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_client.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_client.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_frame.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_frame.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_header.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_header.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_hpack.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_hpack.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_http_extension.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_http_extension.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_huffman.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_huffman.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_log.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_log.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_server.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_server.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_stream.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_stream.c.o.d"
+  "CMakeFiles/co_http2.dir/co_http2_tcp_extension.c.o"
+  "CMakeFiles/co_http2.dir/co_http2_tcp_extension.c.o.d"
+  "libco_http2.a"
+  "libco_http2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/co_http2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libco_http2.a"
+)
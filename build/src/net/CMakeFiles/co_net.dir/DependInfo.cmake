@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/net/co_net.c" "src/net/CMakeFiles/co_net.dir/co_net.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net.c.o.d"
+  "/root/repo/src/net/co_net_addr.c" "src/net/CMakeFiles/co_net.dir/co_net_addr.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_addr.c.o.d"
+  "/root/repo/src/net/co_net_addr_resolve.c" "src/net/CMakeFiles/co_net.dir/co_net_addr_resolve.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_addr_resolve.c.o.d"
+  "/root/repo/src/net/co_net_app.c" "src/net/CMakeFiles/co_net.dir/co_net_app.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_app.c.o.d"
+  "/root/repo/src/net/co_net_log.c" "src/net/CMakeFiles/co_net.dir/co_net_log.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_log.c.o.d"
+  "/root/repo/src/net/co_net_selector_linux.c" "src/net/CMakeFiles/co_net.dir/co_net_selector_linux.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_selector_linux.c.o.d"
+  "/root/repo/src/net/co_net_selector_mac.c" "src/net/CMakeFiles/co_net.dir/co_net_selector_mac.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_selector_mac.c.o.d"
+  "/root/repo/src/net/co_net_selector_win.c" "src/net/CMakeFiles/co_net.dir/co_net_selector_win.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_selector_win.c.o.d"
+  "/root/repo/src/net/co_net_thread.c" "src/net/CMakeFiles/co_net.dir/co_net_thread.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_thread.c.o.d"
+  "/root/repo/src/net/co_net_thread_pool.c" "src/net/CMakeFiles/co_net.dir/co_net_thread_pool.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_thread_pool.c.o.d"
+  "/root/repo/src/net/co_net_worker.c" "src/net/CMakeFiles/co_net.dir/co_net_worker.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_net_worker.c.o.d"
+  "/root/repo/src/net/co_socket.c" "src/net/CMakeFiles/co_net.dir/co_socket.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_socket.c.o.d"
+  "/root/repo/src/net/co_socket_handle.c" "src/net/CMakeFiles/co_net.dir/co_socket_handle.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_socket_handle.c.o.d"
+  "/root/repo/src/net/co_socket_option.c" "src/net/CMakeFiles/co_net.dir/co_socket_option.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_socket_option.c.o.d"
+  "/root/repo/src/net/co_tcp_client.c" "src/net/CMakeFiles/co_net.dir/co_tcp_client.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_tcp_client.c.o.d"
+  "/root/repo/src/net/co_tcp_server.c" "src/net/CMakeFiles/co_net.dir/co_tcp_server.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_tcp_server.c.o.d"
+  "/root/repo/src/net/co_udp.c" "src/net/CMakeFiles/co_net.dir/co_udp.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_udp.c.o.d"
+  "/root/repo/src/net/co_udp_server.c" "src/net/CMakeFiles/co_net.dir/co_udp_server.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_udp_server.c.o.d"
+  "/root/repo/src/net/co_url.c" "src/net/CMakeFiles/co_net.dir/co_url.c.o" "gcc" "src/net/CMakeFiles/co_net.dir/co_url.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/co_net.dir/co_net.c.o"
+  "CMakeFiles/co_net.dir/co_net.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_addr.c.o"
+  "CMakeFiles/co_net.dir/co_net_addr.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_addr_resolve.c.o"
+  "CMakeFiles/co_net.dir/co_net_addr_resolve.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_app.c.o"
+  "CMakeFiles/co_net.dir/co_net_app.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_log.c.o"
+  "CMakeFiles/co_net.dir/co_net_log.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_selector_linux.c.o"
+  "CMakeFiles/co_net.dir/co_net_selector_linux.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_selector_mac.c.o"
+  "CMakeFiles/co_net.dir/co_net_selector_mac.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_selector_win.c.o"
+  "CMakeFiles/co_net.dir/co_net_selector_win.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_thread.c.o"
+  "CMakeFiles/co_net.dir/co_net_thread.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_thread_pool.c.o"
+  "CMakeFiles/co_net.dir/co_net_thread_pool.c.o.d"
+  "CMakeFiles/co_net.dir/co_net_worker.c.o"
+  "CMakeFiles/co_net.dir/co_net_worker.c.o.d"
+  "CMakeFiles/co_net.dir/co_socket.c.o"
+  "CMakeFiles/co_net.dir/co_socket.c.o.d"
+  "CMakeFiles/co_net.dir/co_socket_handle.c.o"
+  "CMakeFiles/co_net.dir/co_socket_handle.c.o.d"
+  "CMakeFiles/co_net.dir/co_socket_option.c.o"
+  "CMakeFiles/co_net.dir/co_socket_option.c.o.d"
+  "CMakeFiles/co_net.dir/co_tcp_client.c.o"
+  "CMakeFiles/co_net.dir/co_tcp_client.c.o.d"
+  "CMakeFiles/co_net.dir/co_tcp_server.c.o"
+  "CMakeFiles/co_net.dir/co_tcp_server.c.o.d"
+  "CMakeFiles/co_net.dir/co_udp.c.o"
+  "CMakeFiles/co_net.dir/co_udp.c.o.d"
+  "CMakeFiles/co_net.dir/co_udp_server.c.o"
+  "CMakeFiles/co_net.dir/co_udp_server.c.o.d"
+  "CMakeFiles/co_net.dir/co_url.c.o"
+  "CMakeFiles/co_net.dir/co_url.c.o.d"
+  "libco_net.a"
+  "libco_net.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/co_net.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
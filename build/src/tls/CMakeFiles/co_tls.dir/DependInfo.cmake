@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tls/co_dtls_udp_client.c" "src/tls/CMakeFiles/co_tls.dir/co_dtls_udp_client.c.o" "gcc" "src/tls/CMakeFiles/co_tls.dir/co_dtls_udp_client.c.o.d"
+  "/root/repo/src/tls/co_dtls_udp_server.c" "src/tls/CMakeFiles/co_tls.dir/co_dtls_udp_server.c.o" "gcc" "src/tls/CMakeFiles/co_tls.dir/co_dtls_udp_server.c.o.d"
+  "/root/repo/src/tls/co_tls.c" "src/tls/CMakeFiles/co_tls.dir/co_tls.c.o" "gcc" "src/tls/CMakeFiles/co_tls.dir/co_tls.c.o.d"
+  "/root/repo/src/tls/co_tls_client.c" "src/tls/CMakeFiles/co_tls.dir/co_tls_client.c.o" "gcc" "src/tls/CMakeFiles/co_tls.dir/co_tls_client.c.o.d"
+  "/root/repo/src/tls/co_tls_config.c" "src/tls/CMakeFiles/co_tls.dir/co_tls_config.c.o" "gcc" "src/tls/CMakeFiles/co_tls.dir/co_tls_config.c.o.d"
+  "/root/repo/src/tls/co_tls_log.c" "src/tls/CMakeFiles/co_tls.dir/co_tls_log.c.o" "gcc" "src/tls/CMakeFiles/co_tls.dir/co_tls_log.c.o.d"
+  "/root/repo/src/tls/co_tls_server.c" "src/tls/CMakeFiles/co_tls.dir/co_tls_server.c.o" "gcc" "src/tls/CMakeFiles/co_tls.dir/co_tls_server.c.o.d"
+  "/root/repo/src/tls/co_tls_tcp_client.c" "src/tls/CMakeFiles/co_tls.dir/co_tls_tcp_client.c.o" "gcc" "src/tls/CMakeFiles/co_tls.dir/co_tls_tcp_client.c.o.d"
+  "/root/repo/src/tls/co_tls_tcp_server.c" "src/tls/CMakeFiles/co_tls.dir/co_tls_tcp_server.c.o" "gcc" "src/tls/CMakeFiles/co_tls.dir/co_tls_tcp_server.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
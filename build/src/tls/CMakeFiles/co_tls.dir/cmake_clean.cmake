@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/co_tls.dir/co_dtls_udp_client.c.o"
+  "CMakeFiles/co_tls.dir/co_dtls_udp_client.c.o.d"
+  "CMakeFiles/co_tls.dir/co_dtls_udp_server.c.o"
+  "CMakeFiles/co_tls.dir/co_dtls_udp_server.c.o.d"
+  "CMakeFiles/co_tls.dir/co_tls.c.o"
+  "CMakeFiles/co_tls.dir/co_tls.c.o.d"
+  "CMakeFiles/co_tls.dir/co_tls_client.c.o"
+  "CMakeFiles/co_tls.dir/co_tls_client.c.o.d"
+  "CMakeFiles/co_tls.dir/co_tls_config.c.o"
+  "CMakeFiles/co_tls.dir/co_tls_config.c.o.d"
+  "CMakeFiles/co_tls.dir/co_tls_log.c.o"
+  "CMakeFiles/co_tls.dir/co_tls_log.c.o.d"
+  "CMakeFiles/co_tls.dir/co_tls_server.c.o"
+  "CMakeFiles/co_tls.dir/co_tls_server.c.o.d"
+  "CMakeFiles/co_tls.dir/co_tls_tcp_client.c.o"
+  "CMakeFiles/co_tls.dir/co_tls_tcp_client.c.o.d"
+  "CMakeFiles/co_tls.dir/co_tls_tcp_server.c.o"
+  "CMakeFiles/co_tls.dir/co_tls_tcp_server.c.o.d"
+  "libco_tls.a"
+  "libco_tls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/co_tls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ws/co_ws.c" "src/ws/CMakeFiles/co_ws.dir/co_ws.c.o" "gcc" "src/ws/CMakeFiles/co_ws.dir/co_ws.c.o.d"
+  "/root/repo/src/ws/co_ws_client.c" "src/ws/CMakeFiles/co_ws.dir/co_ws_client.c.o" "gcc" "src/ws/CMakeFiles/co_ws.dir/co_ws_client.c.o.d"
+  "/root/repo/src/ws/co_ws_config.c" "src/ws/CMakeFiles/co_ws.dir/co_ws_config.c.o" "gcc" "src/ws/CMakeFiles/co_ws.dir/co_ws_config.c.o.d"
+  "/root/repo/src/ws/co_ws_frame.c" "src/ws/CMakeFiles/co_ws.dir/co_ws_frame.c.o" "gcc" "src/ws/CMakeFiles/co_ws.dir/co_ws_frame.c.o.d"
+  "/root/repo/src/ws/co_ws_http_extension.c" "src/ws/CMakeFiles/co_ws.dir/co_ws_http_extension.c.o" "gcc" "src/ws/CMakeFiles/co_ws.dir/co_ws_http_extension.c.o.d"
+  "/root/repo/src/ws/co_ws_log.c" "src/ws/CMakeFiles/co_ws.dir/co_ws_log.c.o" "gcc" "src/ws/CMakeFiles/co_ws.dir/co_ws_log.c.o.d"
+  "/root/repo/src/ws/co_ws_server.c" "src/ws/CMakeFiles/co_ws.dir/co_ws_server.c.o" "gcc" "src/ws/CMakeFiles/co_ws.dir/co_ws_server.c.o.d"
+  "/root/repo/src/ws/co_ws_tcp_extension.c" "src/ws/CMakeFiles/co_ws.dir/co_ws_tcp_extension.c.o" "gcc" "src/ws/CMakeFiles/co_ws.dir/co_ws_tcp_extension.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/co_ws.dir/co_ws.c.o"
+  "CMakeFiles/co_ws.dir/co_ws.c.o.d"
+  "CMakeFiles/co_ws.dir/co_ws_client.c.o"
+  "CMakeFiles/co_ws.dir/co_ws_client.c.o.d"
+  "CMakeFiles/co_ws.dir/co_ws_config.c.o"
+  "CMakeFiles/co_ws.dir/co_ws_config.c.o.d"
+  "CMakeFiles/co_ws.dir/co_ws_frame.c.o"
+  "CMakeFiles/co_ws.dir/co_ws_frame.c.o.d"
+  "CMakeFiles/co_ws.dir/co_ws_http_extension.c.o"
+  "CMakeFiles/co_ws.dir/co_ws_http_extension.c.o.d"
+  "CMakeFiles/co_ws.dir/co_ws_log.c.o"
+  "CMakeFiles/co_ws.dir/co_ws_log.c.o.d"
+  "CMakeFiles/co_ws.dir/co_ws_server.c.o"
+  "CMakeFiles/co_ws.dir/co_ws_server.c.o.d"
+  "CMakeFiles/co_ws.dir/co_ws_tcp_extension.c.o"
+  "CMakeFiles/co_ws.dir/co_ws_tcp_extension.c.o.d"
+  "libco_ws.a"
+  "libco_ws.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/co_ws.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ws_http2/co_ws_http2.c" "src/ws_http2/CMakeFiles/co_ws_http2.dir/co_ws_http2.c.o" "gcc" "src/ws_http2/CMakeFiles/co_ws_http2.dir/co_ws_http2.c.o.d"
+  "/root/repo/src/ws_http2/co_ws_http2_extension.c" "src/ws_http2/CMakeFiles/co_ws_http2.dir/co_ws_http2_extension.c.o" "gcc" "src/ws_http2/CMakeFiles/co_ws_http2.dir/co_ws_http2_extension.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/co_ws_http2.dir/co_ws_http2.c.o"
+  "CMakeFiles/co_ws_http2.dir/co_ws_http2.c.o.d"
+  "CMakeFiles/co_ws_http2.dir/co_ws_http2_extension.c.o"
+  "CMakeFiles/co_ws_http2.dir/co_ws_http2_extension.c.o.d"
+  "libco_ws_http2.a"
+  "libco_ws_http2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/co_ws_http2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,328 @@
+#include <coldforce.h>
+#include <coldforce/core/co_time.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+
+#define MAX_THREAD_COUNT 64
+#define BENCH_EVENT_ID_FINISHED 0x0001
+#define BENCH_MESSAGE "ping"
+
+//---------------------------------------------------------------------------//
+// bench thread object
+//---------------------------------------------------------------------------//
+
+typedef struct
+{
+    co_thread_t base_thread;
+
+    // data
+    co_thread_t* app_thread;
+    co_net_addr_t remote_net_addr;
+    size_t concurrency;
+    size_t target_count;
+    size_t started_count;
+    size_t completed_count;
+    size_t failed_count;
+
+} bench_thread_st;
+
+//---------------------------------------------------------------------------//
+// app object
+//---------------------------------------------------------------------------//
+
+typedef struct
+{
+    co_app_t base_app;
+
+    // app data
+    int thread_count;
+    int finished_count;
+    uint64_t start_time;
+    bench_thread_st bench_thread[MAX_THREAD_COUNT];
+
+} app_st;
+
+//---------------------------------------------------------------------------//
+// bench thread
+//---------------------------------------------------------------------------//
+
+void bench_connect(bench_thread_st* self);
+
+void
+bench_on_finish_one(
+    bench_thread_st* self,
+    co_tcp_client_t* tcp_client,
+    bool success
+)
+{
+    co_tcp_client_destroy(tcp_client);
+
+    if (success)
+    {
+        ++self->completed_count;
+    }
+    else
+    {
+        ++self->failed_count;
+    }
+
+    if (self->started_count < self->target_count)
+    {
+        // next connection
+        bench_connect(self);
+    }
+    else if ((self->completed_count + self->failed_count) ==
+        self->target_count)
+    {
+        co_thread_send_event(self->app_thread,
+            BENCH_EVENT_ID_FINISHED, (uintptr_t)self, 0);
+    }
+}
+
+void
+bench_on_tcp_receive(
+    bench_thread_st* self,
+    co_tcp_client_t* tcp_client
+)
+{
+    char buffer[64];
+
+    ssize_t size =
+        co_tcp_receive(tcp_client, buffer, sizeof(buffer));
+
+    if (size > 0)
+    {
+        // round trip completed, reset instead of a graceful close
+        // so that TIME_WAIT does not exhaust the ephemeral ports
+        struct linger linger = { 1, 0 };
+        co_socket_option_set_linger(
+            co_tcp_get_socket(tcp_client), &linger);
+        co_tcp_close(tcp_client);
+
+        bench_on_finish_one(self, tcp_client, true);
+    }
+}
+
+void
+bench_on_tcp_close(
+    bench_thread_st* self,
+    co_tcp_client_t* tcp_client
+)
+{
+    bench_on_finish_one(self, tcp_client, false);
+}
+
+void
+bench_on_tcp_connect(
+    bench_thread_st* self,
+    co_tcp_client_t* tcp_client,
+    int error_code
+)
+{
+    if (error_code == 0)
+    {
+        co_tcp_send(tcp_client, BENCH_MESSAGE, strlen(BENCH_MESSAGE));
+    }
+    else
+    {
+        bench_on_finish_one(self, tcp_client, false);
+    }
+}
+
+void
+bench_connect(
+    bench_thread_st* self
+)
+{
+    ++self->started_count;
+
+    co_net_addr_t local_net_addr = { 0 };
+    co_net_addr_set_family(
+        &local_net_addr, co_net_addr_get_family(&self->remote_net_addr));
+
+    co_tcp_client_t* tcp_client = co_tcp_client_create(&local_net_addr);
+
+    if (tcp_client == NULL)
+    {
+        ++self->failed_count;
+
+        return;
+    }
+
+    // callbacks
+    co_tcp_callbacks_st* callbacks = co_tcp_get_callbacks(tcp_client);
+    callbacks->on_connect = (co_tcp_connect_fn)bench_on_tcp_connect;
+    callbacks->on_receive = (co_tcp_receive_fn)bench_on_tcp_receive;
+    callbacks->on_close = (co_tcp_close_fn)bench_on_tcp_close;
+
+    // start connect
+    if (!co_tcp_connect_start(tcp_client, &self->remote_net_addr))
+    {
+        bench_on_finish_one(self, tcp_client, false);
+    }
+}
+
+bool
+bench_on_create(
+    bench_thread_st* self
+)
+{
+    for (size_t i = 0;
+        (i < self->concurrency) && (i < self->target_count); ++i)
+    {
+        bench_connect(self);
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// app callback
+//---------------------------------------------------------------------------//
+
+void
+app_on_bench_finished(
+    app_st* self,
+    const co_event_st* event
+)
+{
+    (void)event;
+
+    if (++self->finished_count < self->thread_count)
+    {
+        return;
+    }
+
+    uint64_t elapsed =
+        co_get_current_time_in_msec() - self->start_time;
+
+    size_t completed = 0;
+    size_t failed = 0;
+
+    for (int i = 0; i < self->thread_count; ++i)
+    {
+        completed += self->bench_thread[i].completed_count;
+        failed += self->bench_thread[i].failed_count;
+    }
+
+    printf("%zu connections (%zu failed) in %llu ms: %.0f conn/s\n",
+        completed, failed, (unsigned long long)elapsed,
+        (elapsed > 0) ? ((double)completed * 1000.0 / (double)elapsed) : 0.0);
+
+    // quit app
+    co_app_stop();
+}
+
+bool
+app_on_create(
+    app_st* self
+)
+{
+    const co_args_st* args = co_app_get_args((co_app_t*)self);
+
+    co_net_addr_t remote_net_addr = { 0 };
+
+    if (args->count < 2 ||
+        !co_net_addr_from_string(
+            CO_NET_ADDR_FAMILY_IPV4, args->values[1], &remote_net_addr))
+    {
+        printf("<Usage>\n");
+        printf("tcp_connect_bench <ip_address:port> "
+            "[thread_count] [connections_per_thread] [concurrency]\n");
+
+        return false;
+    }
+
+    self->thread_count = (args->count >= 3) ? atoi(args->values[2]) : 4;
+
+    if (self->thread_count <= 0 ||
+        self->thread_count > MAX_THREAD_COUNT)
+    {
+        self->thread_count = 4;
+    }
+
+    size_t target_count =
+        (args->count >= 4) ? (size_t)atoi(args->values[3]) : 10000;
+    size_t concurrency =
+        (args->count >= 5) ? (size_t)atoi(args->values[4]) : 32;
+
+    co_thread_set_event_handler((co_thread_t*)self,
+        BENCH_EVENT_ID_FINISHED, (co_event_fn)app_on_bench_finished);
+
+    self->finished_count = 0;
+    self->start_time = co_get_current_time_in_msec();
+
+    // start bench threads
+    for (int i = 0; i < self->thread_count; ++i)
+    {
+        bench_thread_st* bench = &self->bench_thread[i];
+
+        bench->app_thread = (co_thread_t*)self;
+        bench->remote_net_addr = remote_net_addr;
+        bench->concurrency = concurrency;
+        bench->target_count = target_count;
+
+        co_net_thread_setup(
+            (co_thread_t*)bench, "bench-thread",
+            (co_thread_create_fn)bench_on_create, NULL);
+
+        co_thread_start((co_thread_t*)bench);
+    }
+
+    return true;
+}
+
+void
+app_on_destroy(
+    app_st* self
+)
+{
+    for (int i = 0; i < self->thread_count; ++i)
+    {
+        co_thread_stop((co_thread_t*)&self->bench_thread[i]);
+    }
+    for (int i = 0; i < self->thread_count; ++i)
+    {
+        co_thread_join((co_thread_t*)&self->bench_thread[i]);
+        co_net_thread_cleanup((co_thread_t*)&self->bench_thread[i]);
+    }
+}
+
+void
+app_on_signal(
+    int sig
+)
+{
+    (void)sig;
+
+    // quit app
+    co_app_stop();
+}
+
+//---------------------------------------------------------------------------//
+// main
+//---------------------------------------------------------------------------//
+
+int
+main(
+    int argc,
+    char* argv[]
+)
+{
+    co_win_debug_crt_set_flags();
+
+    signal(SIGINT, app_on_signal);
+
+    // app instance
+    app_st self = { 0 };
+
+    // start app
+    return co_net_app_start(
+        (co_app_t*)&self, "tcp-connect-bench-app",
+        (co_app_create_fn)app_on_create,
+        (co_app_destroy_fn)app_on_destroy,
+        argc, argv);
+}
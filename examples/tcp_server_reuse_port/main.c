@@ -0,0 +1,342 @@
+#include <coldforce.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+
+#define MAX_THREAD_COUNT 64
+
+//---------------------------------------------------------------------------//
+// worker object
+//---------------------------------------------------------------------------//
+
+typedef struct
+{
+    // data
+    int index;
+    bool reuse_port;
+    bool incoming_cpu;
+    co_net_addr_t local_net_addr;
+    co_tcp_server_t* tcp_server;
+    co_list_t* tcp_clients;
+    size_t accept_count;
+
+} worker_st;
+
+//---------------------------------------------------------------------------//
+// app object
+//---------------------------------------------------------------------------//
+
+typedef struct
+{
+    co_app_t base_app;
+
+    // app data
+    bool reuse_port;
+    int thread_count;
+    co_tcp_server_t* tcp_server;
+    co_net_thread_pool_t* thread_pool;
+    worker_st worker[MAX_THREAD_COUNT];
+
+} app_st;
+
+//---------------------------------------------------------------------------//
+// worker thread
+//---------------------------------------------------------------------------//
+
+void
+worker_on_tcp_receive(
+    co_thread_t* self,
+    co_tcp_client_t* tcp_client
+)
+{
+    (void)self;
+
+    for (;;)
+    {
+        char buffer[8192];
+
+        // receive
+        ssize_t size =
+            co_tcp_receive(tcp_client, buffer, sizeof(buffer));
+
+        if (size <= 0)
+        {
+            break;
+        }
+
+        // echo
+        co_tcp_send(tcp_client, buffer, (size_t)size);
+    }
+}
+
+void
+worker_on_tcp_close(
+    co_thread_t* self,
+    co_tcp_client_t* tcp_client
+)
+{
+    worker_st* worker =
+        (worker_st*)co_net_pool_thread_get_user_data(self);
+
+    co_list_remove(worker->tcp_clients, tcp_client);
+}
+
+void
+worker_on_tcp_accept(
+    co_thread_t* self,
+    co_tcp_server_t* tcp_server,
+    co_tcp_client_t* tcp_client
+)
+{
+    worker_st* worker =
+        (worker_st*)co_net_pool_thread_get_user_data(self);
+
+    if (tcp_server != NULL)
+    {
+        // accepted by the listener of this thread
+        co_tcp_accept(self, tcp_client);
+    }
+
+    // callbacks
+    co_tcp_callbacks_st* callbacks = co_tcp_get_callbacks(tcp_client);
+    callbacks->on_receive = (co_tcp_receive_fn)worker_on_tcp_receive;
+    callbacks->on_close = (co_tcp_close_fn)worker_on_tcp_close;
+
+    co_list_add_tail(worker->tcp_clients, tcp_client);
+
+    ++worker->accept_count;
+}
+
+bool
+worker_on_create(
+    co_thread_t* self
+)
+{
+    worker_st* worker =
+        (worker_st*)co_net_pool_thread_get_user_data(self);
+
+    // client list
+    co_list_ctx_st list_ctx = { 0 };
+    list_ctx.destroy_value =
+        (co_item_destroy_fn)co_tcp_client_destroy; // auto destroy
+    worker->tcp_clients = co_list_create(&list_ctx);
+
+    if (!worker->reuse_port)
+    {
+        // clients are handed off by the thread pool
+        return true;
+    }
+
+    // every worker listens on the same address
+    worker->tcp_server = co_tcp_server_create(&worker->local_net_addr);
+
+    co_socket_option_set_reuse_addr(
+        co_tcp_server_get_socket(worker->tcp_server), true);
+
+    // callbacks
+    co_tcp_server_callbacks_st* callbacks =
+        co_tcp_server_get_callbacks(worker->tcp_server);
+    callbacks->on_accept = (co_tcp_accept_fn)worker_on_tcp_accept;
+
+    // start listen
+    if (!co_tcp_server_start_shared(
+        worker->tcp_server, SOMAXCONN,
+        (worker->incoming_cpu ?
+            worker->index : CO_TCP_SERVER_INCOMING_CPU_ANY)))
+    {
+        printf("worker-%d: failed to start shared listen\n", worker->index);
+
+        return false;
+    }
+
+    return true;
+}
+
+void
+worker_on_destroy(
+    co_thread_t* self
+)
+{
+    worker_st* worker =
+        (worker_st*)co_net_pool_thread_get_user_data(self);
+
+    co_tcp_server_destroy(worker->tcp_server);
+    worker->tcp_server = NULL;
+
+    co_list_destroy(worker->tcp_clients);
+}
+
+//---------------------------------------------------------------------------//
+// app callback
+//---------------------------------------------------------------------------//
+
+void
+app_on_tcp_accept(
+    app_st* self,
+    co_tcp_server_t* tcp_server,
+    co_tcp_client_t* tcp_client
+)
+{
+    (void)tcp_server;
+
+    // hand off to the least loaded worker thread
+    if (!co_net_thread_pool_tcp_accept(self->thread_pool, tcp_client))
+    {
+        co_tcp_client_destroy(tcp_client);
+    }
+}
+
+bool
+app_on_create(
+    app_st* self
+)
+{
+    const co_args_st* args = co_app_get_args((co_app_t*)self);
+
+    if (args->count < 2)
+    {
+        printf("<Usage>\n");
+        printf("tcp_server_reuse_port <port_number> "
+            "[reuseport|reuseport-cpu|handoff] [thread_count]\n");
+
+        return false;
+    }
+
+    uint16_t port = (uint16_t)atoi(args->values[1]);
+
+    const char* mode = (args->count >= 3) ? args->values[2] : "reuseport";
+
+    self->reuse_port = (strcmp(mode, "handoff") != 0);
+    self->thread_count = (args->count >= 4) ? atoi(args->values[3]) : 4;
+
+    if (self->thread_count <= 0 ||
+        self->thread_count > MAX_THREAD_COUNT)
+    {
+        self->thread_count = 4;
+    }
+
+    // local address
+    co_net_addr_t local_net_addr = { 0 };
+    co_net_addr_set_family(&local_net_addr, CO_NET_ADDR_FAMILY_IPV4);
+    co_net_addr_set_port(&local_net_addr, port);
+
+    // worker thread pool
+    self->thread_pool = co_net_thread_pool_create(
+        (size_t)self->thread_count,
+        CO_NET_THREAD_POOL_DISTRIBUTION_LEAST_CONNECTIONS);
+
+    co_net_thread_pool_callbacks_st* pool_callbacks =
+        co_net_thread_pool_get_callbacks(self->thread_pool);
+    pool_callbacks->on_thread_create = worker_on_create;
+    pool_callbacks->on_thread_destroy = worker_on_destroy;
+    pool_callbacks->on_tcp_accept = (co_tcp_accept_fn)worker_on_tcp_accept;
+
+    const bool incoming_cpu = (strcmp(mode, "reuseport-cpu") == 0);
+
+    for (int i = 0; i < self->thread_count; ++i)
+    {
+        worker_st* worker = &self->worker[i];
+
+        worker->index = i;
+        worker->reuse_port = self->reuse_port;
+        worker->incoming_cpu = incoming_cpu;
+        worker->local_net_addr = local_net_addr;
+
+        co_net_thread_pool_set_user_data(self->thread_pool, i, worker);
+
+        if (incoming_cpu)
+        {
+            // pin the thread to the cpu its listener is steered to
+            co_net_thread_pool_set_cpu_affinity(self->thread_pool, i, i);
+        }
+    }
+
+    if (!co_net_thread_pool_start(self->thread_pool))
+    {
+        printf("failed to start worker threads\n");
+
+        return false;
+    }
+
+    if (!self->reuse_port)
+    {
+        // single acceptor on the app thread
+        self->tcp_server = co_tcp_server_create(&local_net_addr);
+
+        co_socket_option_set_reuse_addr(
+            co_tcp_server_get_socket(self->tcp_server), true);
+
+        co_tcp_server_callbacks_st* callbacks =
+            co_tcp_server_get_callbacks(self->tcp_server);
+        callbacks->on_accept = (co_tcp_accept_fn)app_on_tcp_accept;
+
+        co_tcp_server_start(self->tcp_server, SOMAXCONN);
+    }
+
+    char local_str[64];
+    co_net_addr_to_string(&local_net_addr, local_str, sizeof(local_str));
+    printf("start server: %s (%s, %d threads)\n",
+        local_str, mode, self->thread_count);
+
+    return true;
+}
+
+void
+app_on_destroy(
+    app_st* self
+)
+{
+    co_tcp_server_destroy(self->tcp_server);
+
+    // stop and cleanup worker threads
+    co_net_thread_pool_destroy(self->thread_pool);
+
+    size_t total = 0;
+
+    for (int i = 0; i < self->thread_count; ++i)
+    {
+        printf("worker-%d: %zu accepts\n", i, self->worker[i].accept_count);
+
+        total += self->worker[i].accept_count;
+    }
+
+    printf("total: %zu accepts\n", total);
+}
+
+void
+app_on_signal(
+    int sig
+)
+{
+    (void)sig;
+
+    // quit app
+    co_app_stop();
+}
+
+//---------------------------------------------------------------------------//
+// main
+//---------------------------------------------------------------------------//
+
+int
+main(
+    int argc,
+    char* argv[]
+)
+{
+    co_win_debug_crt_set_flags();
+
+    signal(SIGINT, app_on_signal);
+
+    // app instance
+    app_st self = { 0 };
+
+    // start app
+    return co_net_app_start(
+        (co_app_t*)&self, "tcp-server-reuse-port-app",
+        (co_app_create_fn)app_on_create,
+        (co_app_destroy_fn)app_on_destroy,
+        argc, argv);
+}
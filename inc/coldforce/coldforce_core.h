@@ -10,6 +10,7 @@
 #include <coldforce/core/co_list.h>
 #include <coldforce/core/co_string_list.h>
 #include <coldforce/core/co_map.h>
+#include <coldforce/core/co_mem_pool.h>
 #include <coldforce/core/co_string_map.h>
 #include <coldforce/core/co_queue.h>
 #include <coldforce/core/co_string.h>
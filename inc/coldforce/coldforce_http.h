@@ -12,12 +12,16 @@
 #include <coldforce/http/co_http_config.h>
 #include <coldforce/http/co_http_auth.h>
 #include <coldforce/http/co_http_cookie.h>
+#include <coldforce/http/co_http_file.h>
 #include <coldforce/http/co_http_header.h>
 #include <coldforce/http/co_http_request.h>
 #include <coldforce/http/co_http_response.h>
+#include <coldforce/http/co_http_response_template.h>
+#include <coldforce/http/co_http_scan.h>
 #include <coldforce/http/co_http_connection.h>
 #include <coldforce/http/co_http_server.h>
 #include <coldforce/http/co_http_client.h>
+#include <coldforce/http/co_http_pool.h>
 #include <coldforce/http/co_http_tcp_extension.h>
 #include <coldforce/http/co_http_log.h>
 #include <coldforce/http/co_base64.h>
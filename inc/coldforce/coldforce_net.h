@@ -10,6 +10,7 @@
 #include <coldforce/net/co_net_addr.h>
 #include <coldforce/net/co_net_addr_resolve.h>
 #include <coldforce/net/co_net_thread.h>
+#include <coldforce/net/co_net_thread_pool.h>
 #include <coldforce/net/co_net_app.h>
 #include <coldforce/net/co_net_log.h>
 #include <coldforce/net/co_url.h>
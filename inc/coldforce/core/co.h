@@ -116,6 +116,18 @@ typedef struct
 
 } co_buffer_st;
 
+typedef void*(*co_mem_alloc_fn)(size_t size);
+typedef void*(*co_mem_realloc_fn)(void* mem, size_t size);
+typedef void(*co_mem_free_fn)(void* mem);
+
+typedef struct
+{
+    co_mem_alloc_fn alloc;
+    co_mem_realloc_fn realloc;
+    co_mem_free_fn free;
+
+} co_mem_allocator_st;
+
 //---------------------------------------------------------------------------//
 // private
 //---------------------------------------------------------------------------//
@@ -130,9 +142,33 @@ co_mem_free_later(
 // public
 //---------------------------------------------------------------------------//
 
-#define co_mem_alloc        malloc
-#define co_mem_realloc      realloc
-#define co_mem_free         free
+// replaces the heap used by co_mem_alloc/realloc/free (NULL: libc),
+// must be called before co_app_setup allocates anything
+CO_CORE_API
+void
+co_mem_set_allocator(
+    const co_mem_allocator_st* allocator
+);
+
+CO_CORE_API
+void*
+co_mem_alloc(
+    size_t size
+);
+
+CO_CORE_API
+void*
+co_mem_realloc(
+    void* mem,
+    size_t size
+);
+
+CO_CORE_API
+void
+co_mem_free(
+    void* mem
+);
+
 #define co_assert           assert
 #define co_max(l, r)        (((l) > (r)) ? (l) : (r))
 #define co_min(l, r)        (((l) < (r)) ? (l) : (r))
@@ -109,6 +109,29 @@ co_array_zero_clear(
     co_array_t* arr
 );
 
+CO_CORE_API
+size_t
+co_array_get_capacity(
+    const co_array_t* arr
+);
+
+// removes count elements from index, the rest moves down
+CO_CORE_API
+void
+co_array_remove(
+    co_array_t* arr,
+    size_t index,
+    size_t count
+);
+
+// releases the buffer beyond capacity elements, but keeps the elements
+CO_CORE_API
+void
+co_array_shrink(
+    co_array_t* arr,
+    size_t capacity
+);
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
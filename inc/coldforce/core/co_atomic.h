@@ -0,0 +1,84 @@
+#ifndef CO_ATOMIC_H_INCLUDED
+#define CO_ATOMIC_H_INCLUDED
+
+#include <coldforce/core/co.h>
+
+#ifdef CO_OS_WIN
+#   include <intrin.h>
+#endif
+
+CO_EXTERN_C_BEGIN
+
+//---------------------------------------------------------------------------//
+// atomic
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+typedef volatile intptr_t co_atomic_int_t;
+typedef void* volatile co_atomic_ptr_t;
+
+#ifdef CO_OS_WIN
+
+#ifdef _WIN64
+#   define co_atomic_fetch_add(ptr, value) \
+        ((intptr_t)_InterlockedExchangeAdd64( \
+            (volatile __int64*)(ptr), (__int64)(value)))
+#   define co_atomic_exchange(ptr, value) \
+        ((intptr_t)_InterlockedExchange64( \
+            (volatile __int64*)(ptr), (__int64)(value)))
+#else
+#   define co_atomic_fetch_add(ptr, value) \
+        ((intptr_t)_InterlockedExchangeAdd( \
+            (volatile long*)(ptr), (long)(value)))
+#   define co_atomic_exchange(ptr, value) \
+        ((intptr_t)_InterlockedExchange( \
+            (volatile long*)(ptr), (long)(value)))
+#endif
+
+#define co_atomic_load(ptr) \
+    ((intptr_t)co_atomic_fetch_add((ptr), 0))
+#define co_atomic_store(ptr, value) \
+    ((void)co_atomic_exchange((ptr), (value)))
+
+// returns the previous value
+#define co_atomic_compare_exchange_ptr(ptr, expected, desired) \
+    _InterlockedCompareExchangePointer((ptr), (desired), (expected))
+#define co_atomic_exchange_ptr(ptr, value) \
+    _InterlockedExchangePointer((ptr), (value))
+#define co_atomic_load_ptr(ptr) \
+    co_atomic_compare_exchange_ptr((ptr), NULL, NULL)
+
+#else
+
+// sequentially consistent like the interlocked functions, so that
+// store-then-load handshakes between threads behave the same
+#define co_atomic_fetch_add(ptr, value) \
+    __atomic_fetch_add((ptr), (intptr_t)(value), __ATOMIC_SEQ_CST)
+#define co_atomic_exchange(ptr, value) \
+    __atomic_exchange_n((ptr), (intptr_t)(value), __ATOMIC_SEQ_CST)
+#define co_atomic_load(ptr) \
+    __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+#define co_atomic_store(ptr, value) \
+    __atomic_store_n((ptr), (intptr_t)(value), __ATOMIC_SEQ_CST)
+
+// returns the previous value
+#define co_atomic_compare_exchange_ptr(ptr, expected, desired) \
+    __sync_val_compare_and_swap((ptr), (expected), (desired))
+#define co_atomic_exchange_ptr(ptr, value) \
+    __atomic_exchange_n((ptr), (value), __ATOMIC_SEQ_CST)
+#define co_atomic_load_ptr(ptr) \
+    __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+
+#endif // CO_OS_WIN
+
+#define co_atomic_increment(ptr)    ((void)co_atomic_fetch_add((ptr), 1))
+#define co_atomic_decrement(ptr)    ((void)co_atomic_fetch_add((ptr), -1))
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+CO_EXTERN_C_END
+
+#endif // CO_ATOMIC_H_INCLUDED
@@ -75,6 +75,18 @@ typedef co_array_t co_byte_array_t;
 #define co_byte_array_zero_clear(arr) \
     co_array_zero_clear(arr)
 
+// size_t co_byte_array_get_capacity(const co_byte_array_t* arr)
+#define co_byte_array_get_capacity(arr) \
+    co_array_get_capacity(arr)
+
+// void co_byte_array_remove(co_byte_array_t* arr, size_t index, size_t count)
+#define co_byte_array_remove(arr, index, count) \
+    co_array_remove(arr, index, count)
+
+// void co_byte_array_shrink(co_byte_array_t* arr, size_t capacity)
+#define co_byte_array_shrink(arr, capacity) \
+    co_array_shrink(arr, capacity)
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
@@ -2,6 +2,8 @@
 #define CO_EVENT_WORKER_H_INCLUDED
 
 #include <coldforce/core/co.h>
+#include <coldforce/core/co_atomic.h>
+#include <coldforce/core/co_list.h>
 #include <coldforce/core/co_map.h>
 #include <coldforce/core/co_mutex.h>
 #include <coldforce/core/co_semaphore.h>
@@ -26,13 +28,38 @@ typedef void(*co_event_wake_up_fn)(struct co_event_worker_t*);
 typedef bool(*co_event_dispatch_fn)(struct co_event_worker_t*, co_event_st*);
 typedef void(*co_event_idle_fn)(struct co_event_worker_t*);
 
+typedef struct co_event_node_t
+{
+    struct co_event_node_t* next;
+    co_event_st event;
+
+} co_event_node_t;
+
+typedef struct
+{
+    size_t wake_up_count;
+    size_t wake_up_suppressed_count;
+
+} co_event_worker_stats_st;
+
 typedef struct co_event_worker_t
 {
     bool running;
-    bool stop_receiving;
+    co_atomic_int_t stop_receiving;
 
-    co_queue_t* event_queue;
-    co_mutex_t* event_queue_mutex;
+    // other threads inside co_event_worker_add
+    co_atomic_int_t producer_count;
+
+    // events from other threads, lock-free multi-producer stack
+    // drained all at once by the owner thread
+    co_atomic_ptr_t event_stack;
+    co_queue_t* local_event_queue;
+
+    // set while the owner thread is parked in wait,
+    // producers only wake it up when they clear this flag
+    co_atomic_int_t sleeping;
+    co_atomic_int_t wake_up_count;
+    co_atomic_int_t wake_up_suppressed_count;
 
     co_map_t* event_handler_map;
     co_timer_manager_t* timer_manager;
@@ -81,10 +108,9 @@ co_event_worker_add(
     const co_event_st* event
 );
 
-bool
-co_event_worker_pump(
-    co_event_worker_t* event_worker,
-    co_event_st* event
+void
+co_event_worker_stop_receiving(
+    co_event_worker_t* event_worker
 );
 
 bool
@@ -104,11 +130,6 @@ co_event_worker_check_timer(
     co_event_worker_t* event_worker
 );
 
-size_t
-co_event_worker_get_event_count(
-    co_event_worker_t* event_worker
-);
-
 CO_CORE_API
 co_wait_result_t
 co_event_worker_wait(
@@ -135,6 +156,17 @@ co_event_worker_on_idle(
     co_event_worker_t* event_worker
 );
 
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+CO_CORE_API
+void
+co_event_worker_get_stats(
+    const co_event_worker_t* event_worker,
+    co_event_worker_stats_st* stats
+);
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
@@ -0,0 +1,78 @@
+#ifndef CO_MEM_POOL_H_INCLUDED
+#define CO_MEM_POOL_H_INCLUDED
+
+#include <coldforce/core/co.h>
+
+CO_EXTERN_C_BEGIN
+
+//---------------------------------------------------------------------------//
+// memory pool
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+#define CO_MEM_POOL_CLASS_COUNT         5
+#define CO_MEM_POOL_MAX_BLOCK_SIZE      512
+#define CO_MEM_POOL_MAX_CACHED_COUNT    1024
+
+typedef struct
+{
+    // calls on this thread
+    size_t alloc_count;
+    size_t free_count;
+
+    // calls that went through to co_mem_alloc/co_mem_free
+    size_t heap_alloc_count;
+    size_t heap_free_count;
+
+    // blocks parked in the free lists of this thread
+    size_t cached_count;
+    size_t cached_size;
+
+} co_mem_pool_stats_st;
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+void
+co_mem_pool_setup_thread(
+    void
+);
+
+void
+co_mem_pool_cleanup_thread(
+    void
+);
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+// small blocks are recycled through per-thread size class free lists.
+// a block may be freed on any thread, it joins the free list of that thread
+CO_CORE_API
+void*
+co_mem_pool_alloc(
+    size_t size
+);
+
+CO_CORE_API
+void
+co_mem_pool_free(
+    void* mem
+);
+
+CO_CORE_API
+void
+co_mem_pool_get_stats(
+    co_mem_pool_stats_st* stats
+);
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+CO_EXTERN_C_END
+
+#endif // CO_MEM_POOL_H_INCLUDED
@@ -114,6 +114,12 @@ co_thread_set_exit_code(
     int exit_code
 );
 
+CO_CORE_API
+bool
+co_thread_set_cpu_affinity(
+    int cpu
+);
+
 CO_CORE_API
 int
 co_thread_get_exit_code(
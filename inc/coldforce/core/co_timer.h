@@ -18,6 +18,8 @@ struct co_timer_t;
 
 typedef void(*co_timer_fn)(struct co_thread_t* self, struct co_timer_t* timer);
 
+#define CO_TIMER_INVALID_INDEX  ((size_t)-1)
+
 typedef struct co_timer_t
 {
     bool running;
@@ -28,6 +30,8 @@ typedef struct co_timer_t
     co_timer_fn handler;
     void* user_data;
 
+    size_t heap_index;
+
 } co_timer_t;
 
 //---------------------------------------------------------------------------//
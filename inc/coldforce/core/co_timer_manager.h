@@ -3,7 +3,6 @@
 
 #include <coldforce/core/co.h>
 #include <coldforce/core/co_timer.h>
-#include <coldforce/core/co_list.h>
 
 CO_EXTERN_C_BEGIN
 
@@ -18,12 +17,19 @@ typedef struct co_timer_item_t
 {
     co_timer_t* timer;
     uint64_t end;
+    uint64_t seq;
 
 } co_timer_item_t;
 
 typedef struct
 {
-    co_list_t* timers;
+    // 4-ary min heap ordered by (end, seq),
+    // each timer keeps its own slot in heap_index
+
+    co_timer_item_t* items;
+    size_t count;
+    size_t capacity;
+    uint64_t seq;
 
 } co_timer_manager_t;
 
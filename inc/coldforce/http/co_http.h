@@ -57,11 +57,24 @@ CO_EXTERN_C_BEGIN
 #define CO_HTTP_HEADER_UPGRADE              "Upgrade"
 #define CO_HTTP_HEADER_AUTHORIZATION        "Authorization"
 #define CO_HTTP_HEADER_WWW_AUTHENTICATE     "WWW-Authenticate"
+#define CO_HTTP_HEADER_DATE                 "Date"
+#define CO_HTTP_HEADER_CONTENT_TYPE         "Content-Type"
+#define CO_HTTP_HEADER_CONTENT_RANGE        "Content-Range"
+#define CO_HTTP_HEADER_ACCEPT_RANGES        "Accept-Ranges"
+#define CO_HTTP_HEADER_RANGE                "Range"
+#define CO_HTTP_HEADER_IF_RANGE             "If-Range"
+#define CO_HTTP_HEADER_ETAG                 "ETag"
+#define CO_HTTP_HEADER_LAST_MODIFIED        "Last-Modified"
+#define CO_HTTP_HEADER_IF_NONE_MATCH        "If-None-Match"
+#define CO_HTTP_HEADER_IF_MODIFIED_SINCE    "If-Modified-Since"
 
 #define CO_HTTP_TRANSFER_ENCODING_CHUNKED   "chunked"
 
 #define CO_HTTP_UPGRADE_CONNECTION_PREFACE  "cp"
 
+// IMF-fixdate, "Sun, 06 Nov 1994 08:49:37 GMT"
+#define CO_HTTP_DATE_LENGTH                 29
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
@@ -78,6 +91,39 @@ CO_EXTERN_C_BEGIN
 #define CO_HTTP_ERROR_PROTOCOL_ERROR              -5011
 #define CO_HTTP_ERROR_RECEIVE_TIMEOUT             -5012
 
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+// writes unix_time as an IMF-fixdate and a terminating null,
+// buffer must hold CO_HTTP_DATE_LENGTH + 1 bytes
+CO_HTTP_API
+void
+co_http_format_date(
+    int64_t unix_time,
+    char* buffer
+);
+
+// parses an IMF-fixdate. the obsolete formats are not accepted
+CO_HTTP_API
+bool
+co_http_parse_date(
+    const char* str,
+    int64_t* unix_time
+);
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+// current time as an IMF-fixdate for the Date field.
+// formatted at most once per second per thread
+CO_HTTP_API
+const char*
+co_http_get_current_date(
+    void
+);
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
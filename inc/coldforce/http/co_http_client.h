@@ -13,6 +13,7 @@
 #include <coldforce/http/co_http_response.h>
 #include <coldforce/http/co_http_content_receiver.h>
 #include <coldforce/http/co_http_connection.h>
+#include <coldforce/http/co_http_file.h>
 
 CO_EXTERN_C_BEGIN
 
@@ -70,6 +71,12 @@ typedef struct co_http_client_t
     co_http_request_t* request;
     co_http_response_t* response;
 
+    co_http_file_sender_t* file_sender;
+
+    // co_http_response_slot_t*, server responses held back until the
+    // ones of the earlier pipelined requests are sent
+    co_list_t* response_queue;
+
 } co_http_client_t;
 
 //---------------------------------------------------------------------------//
@@ -150,6 +157,29 @@ co_http_is_running(
     const co_http_client_t* client
 );
 
+// stops reading the connection, e.g. while on_receive_data waits for a
+// slow consumer of a streamed body. the data already read is delivered
+// after co_http_resume_receive, and the receive timeout of a client is
+// suspended meanwhile. content streamed through on_receive_data is not
+// limited by co_http_config_set_max_receive_content_size
+CO_HTTP_API
+void
+co_http_pause_receive(
+    co_http_client_t* client
+);
+
+CO_HTTP_API
+void
+co_http_resume_receive(
+    co_http_client_t* client
+);
+
+CO_HTTP_API
+bool
+co_http_is_receive_paused(
+    const co_http_client_t* client
+);
+
 CO_HTTP_API
 co_socket_t*
 co_http_get_socket(
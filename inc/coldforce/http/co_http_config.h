@@ -16,6 +16,9 @@ CO_EXTERN_C_BEGIN
 #define CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_HEADER_FIELD_COUNT     1024
 #define CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_CONTENT_SIZE         SIZE_MAX
 #define CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_WAIT_TIME            (60*1000)
+#define CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_READ_SIZE            (256*1024)
+#define CO_HTTP_CONFIG_DEFAULT_RECEIVE_BUFFER_SIZE              (64*1024)
+#define CO_HTTP_CONFIG_DEFAULT_MAX_DEFERRED_RESPONSE_COUNT        32
 
 typedef struct
 {
@@ -23,6 +26,9 @@ typedef struct
     size_t max_receive_header_field_count;
     size_t max_receive_content_size;
     uint32_t max_receive_wait_time;
+    size_t max_receive_read_size;
+    size_t receive_buffer_size;
+    size_t max_deferred_response_count;
 
 } co_http_config_t;
 
@@ -78,6 +84,48 @@ co_http_config_get_max_receive_wait_time(
     void
 );
 
+// bytes read from a connection before they are handled,
+// applied to connections created afterwards
+CO_HTTP_API
+void
+co_http_config_set_max_receive_read_size(
+    size_t max_receive_read_size
+);
+
+CO_HTTP_API
+size_t
+co_http_config_get_max_receive_read_size(
+    void
+);
+
+// capacity a connection keeps for receiving. a buffer grown beyond it
+// by a large message is shrunk back once the message is consumed
+CO_HTTP_API
+void
+co_http_config_set_receive_buffer_size(
+    size_t receive_buffer_size
+);
+
+CO_HTTP_API
+size_t
+co_http_config_get_receive_buffer_size(
+    void
+);
+
+// pipelined requests a server connection holds without a response.
+// parsing stops at the limit until a response is sent
+CO_HTTP_API
+void
+co_http_config_set_max_deferred_response_count(
+    size_t max_deferred_response_count
+);
+
+CO_HTTP_API
+size_t
+co_http_config_get_max_deferred_response_count(
+    void
+);
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
@@ -9,6 +9,7 @@
 #include <coldforce/http/co_http.h>
 #include <coldforce/http/co_http_request.h>
 #include <coldforce/http/co_http_response.h>
+#include <coldforce/http/co_http_response_template.h>
 
 CO_EXTERN_C_BEGIN
 
@@ -98,6 +99,22 @@ co_http_connection_is_server(
     const co_http_connection_t* conn
 );
 
+// drops the consumed part of the receive buffer and reads after the
+// rest. parsers keep their positions relative to receive_data.index,
+// and header fields viewing the buffer must be materialized before
+CO_HTTP_API
+ssize_t
+co_http_connection_receive(
+    co_http_connection_t* conn
+);
+
+// empties the receive buffer and gives back what a spike grew it by
+CO_HTTP_API
+void
+co_http_connection_clear_receive_data(
+    co_http_connection_t* conn
+);
+
 //---------------------------------------------------------------------------//
 // public
 //---------------------------------------------------------------------------//
@@ -116,6 +133,15 @@ co_http_connection_send_response(
     const co_http_response_t* response
 );
 
+CO_HTTP_API
+bool
+co_http_connection_send_response_template(
+    co_http_connection_t* conn,
+    const co_http_response_template_t* response_template,
+    const void* data,
+    size_t data_size
+);
+
 CO_HTTP_API
 bool
 co_http_connection_send_data(
@@ -124,6 +150,14 @@ co_http_connection_send_data(
     size_t data_size
 );
 
+CO_HTTP_API
+bool
+co_http_connection_send_vec(
+    co_http_connection_t* conn,
+    const co_buffer_st* buffers,
+    size_t buffer_count
+);
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
@@ -0,0 +1,112 @@
+#ifndef CO_HTTP_FILE_H_INCLUDED
+#define CO_HTTP_FILE_H_INCLUDED
+
+#include <coldforce/http/co_http.h>
+#include <coldforce/http/co_http_request.h>
+
+CO_EXTERN_C_BEGIN
+
+//---------------------------------------------------------------------------//
+// http file
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+#define CO_HTTP_FILE_READ_BLOCK_SIZE        (64 * 1024)
+
+// W/"<size>-<mtime>" in hex
+#define CO_HTTP_FILE_ETAG_SIZE              40
+
+#define CO_HTTP_FILE_RANGE_NONE             0
+#define CO_HTTP_FILE_RANGE_SATISFIABLE      1
+#define CO_HTTP_FILE_RANGE_UNSATISFIABLE    2
+
+typedef struct
+{
+    int fd;
+    uint64_t size;
+    int64_t modified_time;
+
+    char etag[CO_HTTP_FILE_ETAG_SIZE];
+
+} co_http_file_st;
+
+// sends a file by reads where sendfile can not be used (tls)
+typedef struct
+{
+    co_http_file_st file;
+
+    uint64_t offset;
+    uint64_t remaining_size;
+
+    uint8_t* buffer;
+
+} co_http_file_sender_t;
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+// opens a regular file and makes its validators
+CO_HTTP_API
+bool
+co_http_file_open(
+    const char* path,
+    co_http_file_st* file
+);
+
+CO_HTTP_API
+void
+co_http_file_close(
+    co_http_file_st* file
+);
+
+CO_HTTP_API
+ssize_t
+co_http_file_read(
+    const co_http_file_st* file,
+    uint64_t offset,
+    void* buffer,
+    size_t size
+);
+
+// true if If-None-Match, or else If-Modified-Since, allows a 304
+CO_HTTP_API
+bool
+co_http_file_is_not_modified(
+    const co_http_file_st* file,
+    const co_http_request_t* request
+);
+
+// evaluates Range and If-Range. only a single byte range is honored,
+// a multi-range request gets the whole file
+CO_HTTP_API
+int
+co_http_file_get_range(
+    const co_http_file_st* file,
+    const co_http_request_t* request,
+    uint64_t* offset,
+    uint64_t* size
+);
+
+CO_HTTP_API
+co_http_file_sender_t*
+co_http_file_sender_create(
+    co_http_file_st* file,
+    uint64_t offset,
+    uint64_t size
+);
+
+CO_HTTP_API
+void
+co_http_file_sender_destroy(
+    co_http_file_sender_t* sender
+);
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+CO_EXTERN_C_END
+
+#endif // CO_HTTP_FILE_H_INCLUDED
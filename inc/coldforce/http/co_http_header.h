@@ -21,14 +21,53 @@ typedef struct
     char* name;
     char* value;
 
+    // name and value point into the receive buffer, not owned
+    bool view;
+
+    // case-insensitive hash of the name
+    uint32_t hash;
+
 } co_http_header_field_t;
 
 typedef struct
 {
+    uint32_t hash;
+
+    // first field with this name, NULL if the slot is empty
+    co_list_iterator_t* it;
+
+} co_http_header_slot_st;
+
+typedef struct
+{
+    // fields in serialization order
     co_list_t* field_list;
 
+    // open-addressed index by name
+    co_http_header_slot_st* slots;
+    size_t slot_count;
+    size_t used_count;
+
 } co_http_header_t;
 
+// well-known fields, looked up without hashing the name
+typedef enum
+{
+    CO_HTTP_HEADER_ID_CONTENT_LENGTH = 0,
+    CO_HTTP_HEADER_ID_HOST,
+    CO_HTTP_HEADER_ID_TRANSFER_ENCODING,
+    CO_HTTP_HEADER_ID_SET_COOKIE,
+    CO_HTTP_HEADER_ID_COOKIE,
+    CO_HTTP_HEADER_ID_CONNECTION,
+    CO_HTTP_HEADER_ID_UPGRADE,
+    CO_HTTP_HEADER_ID_AUTHORIZATION,
+    CO_HTTP_HEADER_ID_WWW_AUTHENTICATE,
+    CO_HTTP_HEADER_ID_DATE,
+
+    CO_HTTP_HEADER_ID_COUNT
+
+} co_http_header_id_t;
+
 //---------------------------------------------------------------------------//
 // private
 //---------------------------------------------------------------------------//
@@ -60,10 +99,16 @@ co_http_header_serialize(
 );
 
 int
-co_http_header_deserialize(
+co_http_header_deserialize_field(
     co_http_header_t* header,
-    const co_byte_array_t* data,
-    size_t* index
+    const char* line,
+    size_t line_length,
+    bool zero_copy
+);
+
+int
+co_http_header_validate_content_length(
+    const co_http_header_t* header
 );
 
 //---------------------------------------------------------------------------//
@@ -76,6 +121,15 @@ co_http_header_clear(
     co_http_header_t* header
 );
 
+// received fields point into the connection's receive buffer and are
+// valid only inside the receive callback. call this before keeping a
+// received request/response beyond it, to give the fields their own copies
+CO_HTTP_API
+bool
+co_http_header_materialize(
+    co_http_header_t* header
+);
+
 CO_HTTP_API
 size_t
 co_http_header_get_field_count(
@@ -111,6 +165,13 @@ co_http_header_get_field(
     const char* name
 );
 
+CO_HTTP_API
+const char*
+co_http_header_get_field_by_id(
+    const co_http_header_t* header,
+    co_http_header_id_t id
+);
+
 CO_HTTP_API
 size_t
 co_http_header_get_fields(
@@ -15,11 +15,33 @@ CO_EXTERN_C_BEGIN
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+#define CO_HTTP_MESSAGE_PARSE_START_LINE    0
+#define CO_HTTP_MESSAGE_PARSE_HEADER        1
+#define CO_HTTP_MESSAGE_PARSE_COMPLETE      2
+
+typedef struct
+{
+    int stage;
+
+    // bytes of complete lines already parsed into the message
+    size_t offset;
+
+    // bytes of the current line already searched for CRLF
+    size_t scan_size;
+
+    // header fields are views into the receive buffer, valid until
+    // the buffer is written again (see co_http_header_materialize)
+    bool zero_copy;
+
+} co_http_message_parser_st;
+
 typedef struct
 {
     co_http_header_t header;
     co_buffer_st data;
 
+    co_http_message_parser_st parser;
+
 } co_http_message_t;
 
 //---------------------------------------------------------------------------//
@@ -36,12 +58,33 @@ co_http_message_cleanup(
     co_http_message_t* message
 );
 
+void
+co_http_message_serialize_header(
+    const co_http_message_t* message,
+    co_byte_array_t* buffer
+);
+
 void
 co_http_message_serialize(
     const co_http_message_t* message,
     co_byte_array_t* buffer
 );
 
+int
+co_http_message_read_line(
+    co_http_message_t* message,
+    const co_byte_array_t* data,
+    size_t index,
+    const char** line,
+    size_t* line_length
+);
+
+void
+co_http_message_consume_line(
+    co_http_message_t* message,
+    size_t line_length
+);
+
 int
 co_http_message_deserialize_header(
     co_http_message_t* message,
@@ -49,6 +92,11 @@ co_http_message_deserialize_header(
     size_t* index
 );
 
+bool
+co_http_message_is_header_complete(
+    const co_http_message_t* message
+);
+
 bool
 co_http_message_set_data(
     co_http_message_t* request,
@@ -0,0 +1,205 @@
+#ifndef CO_HTTP_POOL_H_INCLUDED
+#define CO_HTTP_POOL_H_INCLUDED
+
+#include <coldforce/core/co_list.h>
+#include <coldforce/core/co_map.h>
+#include <coldforce/core/co_timer.h>
+
+#include <coldforce/net/co_net_addr.h>
+
+#include <coldforce/tls/co_tls.h>
+
+#include <coldforce/http/co_http.h>
+#include <coldforce/http/co_http_client.h>
+
+CO_EXTERN_C_BEGIN
+
+//---------------------------------------------------------------------------//
+// http pool
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+#define CO_HTTP_POOL_DEFAULT_MAX_CONNECTIONS_PER_ORIGIN     6
+#define CO_HTTP_POOL_DEFAULT_IDLE_TIMEOUT                   (30*1000)
+#define CO_HTTP_POOL_DEFAULT_MAX_PIPELINE_DEPTH             1
+
+struct co_http_pool_t;
+
+typedef void(*co_http_pool_receive_finish_fn)(
+    co_thread_t* self, struct co_http_pool_t* pool,
+    const co_http_request_t* request,
+    const co_http_response_t* response,
+    int error_code, void* request_user_data);
+
+typedef struct
+{
+    co_http_pool_receive_finish_fn on_receive_finish;
+
+} co_http_pool_callbacks_st;
+
+typedef struct
+{
+    // requests sent on a connection that was already open
+    uint64_t hit_count;
+
+    // requests that had to wait for a new connection
+    uint64_t miss_count;
+
+    // connections established, tcp connect and tls handshake
+    uint64_t handshake_count;
+
+} co_http_pool_stats_st;
+
+typedef struct
+{
+    co_http_request_t* request;
+    void* user_data;
+
+    // sent on a connection that had served a request before
+    bool reused;
+    bool retried;
+
+} co_http_pool_pending_t;
+
+typedef struct
+{
+    char* url_origin;
+
+    // co_http_pool_connection_t*
+    co_list_t* connection_list;
+
+    // co_http_pool_pending_t* not sent yet
+    co_list_t* wait_queue;
+
+} co_http_pool_origin_t;
+
+typedef struct
+{
+    struct co_http_pool_t* pool;
+    co_http_pool_origin_t* origin;
+
+    co_http_client_t* client;
+    co_timer_t* idle_timer;
+
+    bool connected;
+    bool reusable;
+    uint64_t served_count;
+
+    // destroyed once the running callback has returned
+    bool in_callback;
+    bool closed;
+
+    // co_http_pool_pending_t* sent, in the order of the responses
+    co_list_t* send_queue;
+
+} co_http_pool_connection_t;
+
+typedef struct co_http_pool_t
+{
+    co_thread_t* owner_thread;
+
+    co_net_addr_t local_net_addr;
+
+    // every tls connection takes a reference of the ssl context
+    co_tls_ctx_st tls_ctx;
+
+    co_http_pool_callbacks_st callbacks;
+
+    size_t max_connections_per_origin;
+    uint32_t idle_timeout;
+    size_t max_pipeline_depth;
+
+    // url origin -> co_http_pool_origin_t
+    co_map_t* origin_map;
+
+    co_http_pool_stats_st stats;
+
+} co_http_pool_t;
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+// a pool belongs to the thread that creates it, and reuses keep-alive
+// connections for requests to the same url origin. the pool takes
+// tls_ctx over, it is needed only for https origins
+CO_HTTP_API
+co_http_pool_t*
+co_http_pool_create(
+    const co_net_addr_t* local_net_addr,
+    co_tls_ctx_st* tls_ctx
+);
+
+CO_HTTP_API
+void
+co_http_pool_destroy(
+    co_http_pool_t* pool
+);
+
+CO_HTTP_API
+co_http_pool_callbacks_st*
+co_http_pool_get_callbacks(
+    co_http_pool_t* pool
+);
+
+// requests beyond the limit wait for a connection of their origin
+CO_HTTP_API
+void
+co_http_pool_set_max_connections_per_origin(
+    co_http_pool_t* pool,
+    size_t max_connection_count
+);
+
+// an idle connection is closed after msec, counted from the next time
+// a connection goes idle
+CO_HTTP_API
+void
+co_http_pool_set_idle_timeout(
+    co_http_pool_t* pool,
+    uint32_t msec
+);
+
+// requests sent on a connection before its first response arrives.
+// only GET and HEAD are pipelined (default: 1, no pipelining)
+CO_HTTP_API
+void
+co_http_pool_set_max_pipeline_depth(
+    co_http_pool_t* pool,
+    size_t max_depth
+);
+
+// the pool takes the request over. on_receive_finish is called with
+// request_user_data once the response, or an error, has arrived. the
+// request is NULL there if it was lost with a failed connection. a GET
+// or HEAD whose reused connection was closed by the peer is sent again
+// once on another connection
+CO_HTTP_API
+bool
+co_http_pool_send_request(
+    co_http_pool_t* pool,
+    const char* url_origin,
+    co_http_request_t* request,
+    void* request_user_data
+);
+
+CO_HTTP_API
+const co_http_pool_stats_st*
+co_http_pool_get_stats(
+    const co_http_pool_t* pool
+);
+
+CO_HTTP_API
+size_t
+co_http_pool_get_connection_count(
+    const co_http_pool_t* pool,
+    const char* url_origin
+);
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+CO_EXTERN_C_END
+
+#endif // CO_HTTP_POOL_H_INCLUDED
@@ -33,6 +33,13 @@ typedef struct co_http_request_t
 // private
 //---------------------------------------------------------------------------//
 
+CO_HTTP_API
+void
+co_http_request_serialize_header(
+    const co_http_request_t* request,
+    co_byte_array_t* buffer
+);
+
 CO_HTTP_API
 void
 co_http_request_serialize(
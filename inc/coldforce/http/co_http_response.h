@@ -28,6 +28,20 @@ typedef struct co_http_response_t
 // private
 //---------------------------------------------------------------------------//
 
+CO_HTTP_API
+void
+co_http_response_serialize_line(
+    const co_http_response_t* response,
+    co_byte_array_t* buffer
+);
+
+CO_HTTP_API
+void
+co_http_response_serialize_header(
+    const co_http_response_t* response,
+    co_byte_array_t* buffer
+);
+
 CO_HTTP_API
 void
 co_http_response_serialize(
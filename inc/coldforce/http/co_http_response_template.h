@@ -0,0 +1,78 @@
+#ifndef CO_HTTP_RESPONSE_TEMPLATE_H_INCLUDED
+#define CO_HTTP_RESPONSE_TEMPLATE_H_INCLUDED
+
+#include <coldforce/core/co_byte_array.h>
+
+#include <coldforce/http/co_http.h>
+#include <coldforce/http/co_http_response.h>
+
+CO_EXTERN_C_BEGIN
+
+//---------------------------------------------------------------------------//
+// http response template
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+// "Content-Length: " + digits + CRLF + "Date: " + date + CRLF + CRLF
+#define CO_HTTP_RESPONSE_TEMPLATE_TAIL_SIZE     96
+
+typedef struct
+{
+    // status line and fixed fields, without the terminating CRLF
+    co_byte_array_t* header_block;
+
+    // false for the statuses that never have a body (1xx, 204, 304)
+    bool content_length;
+    bool date;
+
+} co_http_response_template_t;
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+// writes the per-response fields and the end of the header into tail,
+// returns the size written
+CO_HTTP_API
+size_t
+co_http_response_template_serialize_tail(
+    const co_http_response_template_t* response_template,
+    size_t data_size,
+    char* tail
+);
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+// serializes the status line and fields of response once.
+// Content-Length and Date are left out and written on each send.
+// 1xx, 204 and 304 responses get no Content-Length
+CO_HTTP_API
+co_http_response_template_t*
+co_http_response_template_create(
+    const co_http_response_t* response
+);
+
+CO_HTTP_API
+void
+co_http_response_template_destroy(
+    co_http_response_template_t* response_template
+);
+
+// adds the cached Date field on each send (default: true)
+CO_HTTP_API
+void
+co_http_response_template_set_date(
+    co_http_response_template_t* response_template,
+    bool enable
+);
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+CO_EXTERN_C_END
+
+#endif // CO_HTTP_RESPONSE_TEMPLATE_H_INCLUDED
@@ -0,0 +1,90 @@
+#ifndef CO_HTTP_SCAN_H_INCLUDED
+#define CO_HTTP_SCAN_H_INCLUDED
+
+#include <coldforce/http/co_http.h>
+
+CO_EXTERN_C_BEGIN
+
+//---------------------------------------------------------------------------//
+// http scan
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+typedef enum
+{
+    CO_HTTP_SCAN_LEVEL_SCALAR = 0,
+    CO_HTTP_SCAN_LEVEL_SSE2 = 1,
+    CO_HTTP_SCAN_LEVEL_AVX2 = 2
+
+} co_http_scan_level_t;
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+// returns the position of the first CRLF, or NULL
+CO_HTTP_API
+const char*
+co_http_scan_crlf(
+    const char* data,
+    size_t length
+);
+
+// returns the position of the first ch, or NULL
+CO_HTTP_API
+const char*
+co_http_scan_char(
+    const char* data,
+    size_t length,
+    char ch
+);
+
+// returns the length of the leading run of token characters
+CO_HTTP_API
+size_t
+co_http_scan_token(
+    const char* data,
+    size_t length
+);
+
+// narrows [begin, end) to exclude leading and trailing SP and HTAB
+CO_HTTP_API
+void
+co_http_scan_trim_ows(
+    const char* data,
+    size_t* begin,
+    size_t* end
+);
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+// selects the scanner, clamped to what the cpu supports.
+// the best supported level is selected by default on first use
+CO_HTTP_API
+co_http_scan_level_t
+co_http_scan_set_level(
+    co_http_scan_level_t level
+);
+
+CO_HTTP_API
+co_http_scan_level_t
+co_http_scan_get_level(
+    void
+);
+
+CO_HTTP_API
+co_http_scan_level_t
+co_http_scan_get_supported_level(
+    void
+);
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+CO_EXTERN_C_END
+
+#endif // CO_HTTP_SCAN_H_INCLUDED
@@ -13,6 +13,17 @@ CO_EXTERN_C_BEGIN
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+// the place of a pipelined request among the responses of its connection
+typedef struct
+{
+    co_http_request_t* request;
+
+    // the serialized response, once sent before its turn
+    co_byte_array_t* data;
+    bool ready;
+
+} co_http_response_slot_t;
+
 //---------------------------------------------------------------------------//
 // private
 //---------------------------------------------------------------------------//
@@ -29,6 +40,18 @@ co_http_server_on_http_connection_close(
     co_http_connection_t* conn
 );
 
+bool
+co_http_server_is_holding_response(
+    const co_http_client_t* client
+);
+
+bool
+co_http_server_add_held_data(
+    co_http_client_t* client,
+    const void* data,
+    size_t data_size
+);
+
 //---------------------------------------------------------------------------//
 // public
 //---------------------------------------------------------------------------//
@@ -40,6 +63,101 @@ co_http_send_response(
     co_http_response_t* response
 );
 
+// keeps the request given to on_receive_finish and lets the server go
+// on with the pipelined requests after it. the response is sent later
+// by co_http_send_deferred_response, from the thread of the client, and
+// responses are written in the order of the requests whatever order
+// they are sent in. a response sent by co_http_send_response while
+// earlier ones are deferred is held back as well. the slot is released
+// with the response, or with the client. if a held response can not be
+// sent or kept, the connection is closed
+CO_HTTP_API
+co_http_response_slot_t*
+co_http_defer_response(
+    co_http_client_t* client
+);
+
+CO_HTTP_API
+const co_http_request_t*
+co_http_response_slot_get_request(
+    const co_http_response_slot_t* slot
+);
+
+CO_HTTP_API
+bool
+co_http_send_deferred_response(
+    co_http_client_t* client,
+    co_http_response_slot_t* slot,
+    co_http_response_t* response
+);
+
+CO_HTTP_API
+bool
+co_http_send_deferred_response_template(
+    co_http_client_t* client,
+    co_http_response_slot_t* slot,
+    const co_http_response_template_t* response_template,
+    const void* data,
+    size_t data_size
+);
+
+// requests whose responses have not been written yet
+CO_HTTP_API
+size_t
+co_http_get_deferred_response_count(
+    const co_http_client_t* client
+);
+
+// sends the template with data as the content in a single write.
+// the template is not consumed and can be shared by all clients
+// of the thread
+CO_HTTP_API
+bool
+co_http_send_response_template(
+    co_http_client_t* client,
+    const co_http_response_template_t* response_template,
+    const void* data,
+    size_t data_size
+);
+
+// sends the file at path as the content of response, with sendfile(2)
+// on a plain tcp connection and by reads paced by the send buffer
+// watermarks on tls. ETag and Last-Modified are added, and a GET or
+// HEAD request whose If-None-Match or If-Modified-Since matches gets 304
+// instead. request can be NULL to skip the conditions. returns false,
+// without sending anything, if the file can not be opened. if the
+// content fails after the header went out, the connection is closed.
+// until the content is queued (co_http_is_sending_file) other responses
+// are held back and pipelined requests are not parsed. fails while
+// responses are deferred
+CO_HTTP_API
+bool
+co_http_send_file_response(
+    co_http_client_t* client,
+    const co_http_request_t* request,
+    co_http_response_t* response,
+    const char* path
+);
+
+// co_http_send_file_response that also honors a single byte Range
+// (206 or 416) and announces Accept-Ranges
+CO_HTTP_API
+bool
+co_http_send_file_range_response(
+    co_http_client_t* client,
+    const co_http_request_t* request,
+    co_http_response_t* response,
+    const char* path
+);
+
+// true while the content of a file response is being read and sent
+CO_HTTP_API
+bool
+co_http_is_sending_file(
+    const co_http_client_t* client
+);
+
+// fails while responses are deferred or a file is being sent
 CO_HTTP_API
 bool
 co_http_start_chunked_response(
@@ -61,6 +61,9 @@ CO_EXTERN_C_BEGIN
 
 #define CO_HTTP2_SETTING_MAX_WINDOW_SIZE                    INT32_MAX
 
+// the encoder table never grows past this, whatever the peer allows
+#define CO_HTTP2_HPACK_MAX_ENCODER_TABLE_SIZE               4096
+
 // identifier
 #define CO_HTTP2_SETTING_ID_HEADER_TABLE_SIZE         1
 #define CO_HTTP2_SETTING_ID_ENABLE_PUSH               2
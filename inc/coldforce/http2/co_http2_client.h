@@ -19,6 +19,9 @@ CO_EXTERN_C_BEGIN
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+#define CO_HTTP2_DEFAULT_MAX_SEND_DATA_POOL_SIZE    (1024 * 1024)
+#define CO_HTTP2_SEND_BUFFER_FLUSH_SIZE             (16 * 1024)
+
 struct co_http2_client_t;
 
 typedef void(*co_http2_connect_fn)(
@@ -34,6 +37,9 @@ typedef void(*co_http2_priority_fn)(
 typedef void(*co_http2_window_update_fn)(
     co_thread_t* self, struct co_http2_client_t* client, co_http2_stream_t* stream);
 
+typedef void(*co_http2_send_complete_fn)(
+    co_thread_t* self, struct co_http2_client_t* client, co_http2_stream_t* stream);
+
 typedef void(*co_http2_close_stream_fn)(
     co_thread_t* self, struct co_http2_client_t* client, co_http2_stream_t* stream, int error_code);
 
@@ -72,6 +78,7 @@ typedef struct
     co_http2_window_update_fn on_window_update;
     co_http2_close_stream_fn on_close_stream;
     co_http2_ping_fn on_ping;
+    co_http2_send_complete_fn on_send_complete;
 
 } co_http2_callbacks_st;
 
@@ -83,6 +90,17 @@ typedef struct co_http2_client_t
     co_http2_stream_t* system_stream;
     co_map_t* stream_map;
 
+    // co_http2_stream_t* holding data back for the windows
+    co_list_t* send_waiting_streams;
+    size_t max_send_data_pool_size;
+
+    // virtual time of the incremental stream served last
+    uint64_t send_pass;
+
+    // frames serialized while corked, sent in one go at uncork
+    co_byte_array_t* send_buffer;
+    uint32_t cork_count;
+
     uint32_t last_stream_id;
     uint32_t new_stream_id;
 
@@ -135,6 +153,35 @@ co_http2_client_on_receive_system_frame(
     const co_http2_frame_t* frame
 );
 
+// the waiting stream to send next: lowest urgency first, then
+// non-incremental by stream id, then incremental by weight.
+// NULL if no waiting stream has window to send
+co_http2_stream_t*
+co_http2_client_select_send_stream(
+    co_http2_client_t* client
+);
+
+// sends the data held back by the streams, frame by frame in the
+// order co_http2_client_select_send_stream picks
+void
+co_http2_client_send_pending_data(
+    co_http2_client_t* client
+);
+
+// queues serialized frame bytes behind send_buffer, or sends them
+// together with it when not corked or past the flush size
+bool
+co_http2_client_send_buffers(
+    co_http2_client_t* client,
+    const co_buffer_st* buffers,
+    size_t buffer_count
+);
+
+bool
+co_http2_client_flush(
+    co_http2_client_t* client
+);
+
 bool
 co_http2_set_upgrade_settings(
     const char* b64_settings,
@@ -227,6 +274,29 @@ co_http2_update_settings(
     uint16_t param_count
 );
 
+// frames sent between cork and uncork are coalesced into as few sends
+// as possible. nestable; frame dispatch from the peer is corked already
+CO_HTTP2_API
+void
+co_http2_cork(
+    co_http2_client_t* client
+);
+
+CO_HTTP2_API
+bool
+co_http2_uncork(
+    co_http2_client_t* client
+);
+
+// bytes a stream may hold back for the flow control windows
+// (default: 1MiB)
+CO_HTTP2_API
+void
+co_http2_set_max_send_data_pool_size(
+    co_http2_client_t* client,
+    size_t max_size
+);
+
 CO_HTTP2_API
 const co_http2_settings_st*
 co_http2_get_local_settings(
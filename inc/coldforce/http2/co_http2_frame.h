@@ -32,6 +32,7 @@ CO_EXTERN_C_BEGIN
 #define CO_HTTP2_FRAME_FLAG_PRIORITY        0x20
 
 #define CO_HTTP2_FRAME_HEADER_SIZE          9
+#define CO_HTTP2_FRAME_MAX_VEC_COUNT        3
 
 struct co_http2_client_t;
 
@@ -156,6 +157,13 @@ co_http2_frame_serialize(
     co_byte_array_t* buffer
 );
 
+size_t
+co_http2_frame_serialize_vec(
+    const co_http2_frame_t* frame,
+    co_byte_array_t* buffer,
+    co_buffer_st* buffers
+);
+
 int
 co_http2_frame_deserialize(
     const co_byte_array_t* data,
@@ -19,6 +19,11 @@ CO_EXTERN_C_BEGIN
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+#define CO_HTTP2_HEADER_PRIORITY                "priority"
+
+#define CO_HTTP2_PRIORITY_DEFAULT_URGENCY       3
+#define CO_HTTP2_PRIORITY_MAX_URGENCY           7
+
 typedef struct co_http2_data_st
 {
     uint8_t* ptr;
@@ -211,6 +216,25 @@ co_http2_header_get_weight(
     const co_http2_header_t* header
 );
 
+// "priority" field (RFC 9218): urgency 0 (highest) to 7, incremental
+CO_HTTP2_API
+void
+co_http2_header_set_priority(
+    co_http2_header_t* header,
+    uint8_t urgency,
+    bool incremental
+);
+
+// false if the field is absent, urgency and incremental get
+// the defaults then
+CO_HTTP2_API
+bool
+co_http2_header_get_priority(
+    const co_http2_header_t* header,
+    uint8_t* urgency,
+    bool* incremental
+);
+
 CO_HTTP2_API
 size_t
 co_http2_header_get_field_count(
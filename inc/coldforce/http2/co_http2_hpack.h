@@ -1,7 +1,6 @@
 #ifndef CO_HTTP2_HPACK_H_INCLUDED
 #define CO_HTTP2_HPACK_H_INCLUDED
 
-#include <coldforce/core/co_list.h>
 #include <coldforce/core/co_byte_array.h>
 
 #include <coldforce/http2/co_http2.h>
@@ -32,19 +31,52 @@ struct co_http2_message_t;
 
 typedef struct
 {
-    uint32_t size;
+    // offset of the name in the arena. name and value are NUL
+    // terminated, the value follows the name
+    uint32_t offset;
+    uint32_t name_length;
+    uint32_t value_length;
 
-    char* name;
-    char* value;
+    // encoder index chains, the next older entry with the same
+    // name or the same name and value (insertion number + 1, 0 is none)
+    uint32_t name_next;
+    uint32_t field_next;
 
-} co_http2_hpack_dynamic_table_item_t;
+} co_http2_hpack_dynamic_table_entry_st;
 
 typedef struct
 {
     uint32_t max_size;
     uint32_t total_size;
 
-    co_list_t* items;
+    // ring of the entries, the oldest at entry_head
+    co_http2_hpack_dynamic_table_entry_st* entries;
+    uint32_t entry_capacity;
+    uint32_t entry_head;
+    uint32_t entry_count;
+
+    // name and value bytes of the entries, oldest first
+    // in [arena_start, arena_end)
+    uint8_t* arena;
+    uint32_t arena_capacity;
+    uint32_t arena_start;
+    uint32_t arena_end;
+
+    // number of entries ever inserted. the newest entry is
+    // insert_count - 1, the oldest live one insert_count - entry_count
+    uint32_t insert_count;
+
+    // encoder index, the newest entry (insertion number + 1) for
+    // each hash of the name and of the name and value. built on the
+    // first serialize, so the decoder table never has one
+    uint32_t* name_buckets;
+    uint32_t* field_buckets;
+    uint32_t bucket_capacity;
+
+    // encoder size change not announced yet, the smallest size since
+    // the last header block goes first (RFC 7541 4.2)
+    bool size_update_pending;
+    uint32_t min_pending_size;
 
 } co_http2_hpack_dynamic_table_t;
 
@@ -63,6 +95,12 @@ co_http2_hpack_dynamic_table_cleanup(
     co_http2_hpack_dynamic_table_t* dynamic_table
 );
 
+void
+co_http2_hpack_dynamic_table_set_max_size(
+    co_http2_hpack_dynamic_table_t* dynamic_table,
+    uint32_t max_size
+);
+
 void
 co_http2_hpack_serialize_header(
     const struct co_http2_header_t* header,
@@ -28,6 +28,9 @@ struct co_thread_t;
 #define CO_HTTP2_STREAM_STATE_RESERVED_REMOTE       6
 #define CO_HTTP2_STREAM_STATE_PROTOCOL              10
 
+#define CO_HTTP2_STREAM_DEFAULT_WEIGHT              16
+#define CO_HTTP2_STREAM_MAX_WEIGHT                  256
+
 #define CO_HTTP2_STREAM_ERROR_NO_ERROR              0x0
 #define CO_HTTP2_STREAM_ERROR_PROTOCOL_ERROR        0x1
 #define CO_HTTP2_STREAM_ERROR_INTERNAL_ERROR        0x2
@@ -84,9 +87,34 @@ typedef struct co_http2_stream_t
     co_byte_array_t* receive_data_pool;
 
     uint32_t max_local_window_size;
-    uint32_t remote_window_size;
     uint32_t local_window_size;
 
+    // goes negative when SETTINGS_INITIAL_WINDOW_SIZE shrinks it
+    int64_t remote_window_size;
+
+    // data the flow control windows held back, sent as they open
+    struct co_http2_send_data_pool_t
+    {
+        co_byte_array_t* data;
+        size_t index;
+        bool end_stream;
+        bool waiting;
+
+    } send_data_pool;
+
+    // order of the held back data among the streams. urgency and
+    // incremental from the priority field, the dependency and
+    // weight from HEADERS/PRIORITY frames
+    struct co_http2_stream_priority_t
+    {
+        uint8_t urgency;
+        bool incremental;
+        uint32_t stream_dependency;
+        uint16_t weight;
+        uint64_t pass;
+
+    } priority;
+
     uint32_t promised_stream_id;
 
     struct Protocol
@@ -130,6 +158,15 @@ co_http2_stream_send_frame(
     co_http2_frame_t* frame
 );
 
+// sends up to max_size of the held back data as the windows allow.
+// returns the bytes sent, or -1 if the stream can no longer send and
+// the held back data is dropped
+ssize_t
+co_http2_stream_send_pending_data(
+    co_http2_stream_t* stream,
+    size_t max_size
+);
+
 void
 co_http2_stream_update_local_window_size(
     co_http2_stream_t* stream,
@@ -153,6 +190,11 @@ co_http2_stream_get_protocol_data(
 // public
 //---------------------------------------------------------------------------//
 
+// sends as much as the stream and connection windows allow, and holds
+// the rest back until WINDOW_UPDATEs open them. returns the bytes taken,
+// which is less than data_size only when the held back data would pass
+// co_http2_set_max_send_data_pool_size; on_send_complete tells when the
+// held back data is out
 CO_HTTP2_API
 ssize_t
 co_http2_stream_send_data(
@@ -235,6 +277,13 @@ co_http2_stream_get_sendable_data_size(
     const co_http2_stream_t* stream
 );
 
+// bytes held back by the flow control windows
+CO_HTTP2_API
+size_t
+co_http2_stream_get_pending_data_size(
+    const co_http2_stream_t* stream
+);
+
 CO_HTTP2_API
 bool
 co_http2_stream_set_protocol_mode(
@@ -0,0 +1,175 @@
+#ifndef CO_NET_THREAD_POOL_H_INCLUDED
+#define CO_NET_THREAD_POOL_H_INCLUDED
+
+#include <coldforce/core/co_atomic.h>
+#include <coldforce/core/co_thread.h>
+
+#include <coldforce/net/co_net.h>
+#include <coldforce/net/co_tcp_server.h>
+#include <coldforce/net/co_udp_server.h>
+
+CO_EXTERN_C_BEGIN
+
+//---------------------------------------------------------------------------//
+// net thread pool
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+#define CO_NET_THREAD_POOL_CPU_ANY  -1
+
+typedef enum
+{
+    CO_NET_THREAD_POOL_DISTRIBUTION_ROUND_ROBIN = 0,
+    CO_NET_THREAD_POOL_DISTRIBUTION_LEAST_CONNECTIONS = 1
+
+} co_net_thread_pool_distribution_t;
+
+struct co_net_thread_pool_t;
+
+typedef struct
+{
+    co_thread_t base_thread;
+
+    struct co_net_thread_pool_t* pool;
+    size_t index;
+    int cpu;
+
+    // handed off but not yet registered on the thread
+    co_atomic_int_t pending_count;
+    co_atomic_int_t accept_count;
+
+    void* user_data;
+
+} co_net_pool_thread_t;
+
+typedef struct
+{
+    // called on the pool thread
+    co_thread_create_fn on_thread_create;
+    co_thread_destroy_fn on_thread_destroy;
+    co_tcp_accept_fn on_tcp_accept;
+    co_udp_accept_fn on_udp_accept;
+
+} co_net_thread_pool_callbacks_st;
+
+typedef struct
+{
+    size_t connection_count;
+    size_t pending_count;
+    size_t accept_count;
+
+} co_net_thread_pool_stats_st;
+
+typedef struct co_net_thread_pool_t
+{
+    co_net_pool_thread_t* threads;
+    size_t thread_count;
+
+    co_net_thread_pool_distribution_t distribution;
+    co_atomic_int_t next_index;
+    bool running;
+
+    co_net_thread_pool_callbacks_st callbacks;
+
+} co_net_thread_pool_t;
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+CO_NET_API
+co_net_thread_pool_t*
+co_net_thread_pool_create(
+    size_t thread_count,
+    co_net_thread_pool_distribution_t distribution
+);
+
+CO_NET_API
+void
+co_net_thread_pool_destroy(
+    co_net_thread_pool_t* pool
+);
+
+CO_NET_API
+co_net_thread_pool_callbacks_st*
+co_net_thread_pool_get_callbacks(
+    co_net_thread_pool_t* pool
+);
+
+CO_NET_API
+bool
+co_net_thread_pool_set_cpu_affinity(
+    co_net_thread_pool_t* pool,
+    size_t index,
+    int cpu
+);
+
+CO_NET_API
+bool
+co_net_thread_pool_start(
+    co_net_thread_pool_t* pool
+);
+
+CO_NET_API
+void
+co_net_thread_pool_stop(
+    co_net_thread_pool_t* pool
+);
+
+CO_NET_API
+bool
+co_net_thread_pool_tcp_accept(
+    co_net_thread_pool_t* pool,
+    co_tcp_client_t* client
+);
+
+CO_NET_API
+bool
+co_net_thread_pool_udp_accept(
+    co_net_thread_pool_t* pool,
+    co_udp_t* udp_conn
+);
+
+CO_NET_API
+size_t
+co_net_thread_pool_get_thread_count(
+    const co_net_thread_pool_t* pool
+);
+
+CO_NET_API
+co_thread_t*
+co_net_thread_pool_get_thread(
+    co_net_thread_pool_t* pool,
+    size_t index
+);
+
+CO_NET_API
+void
+co_net_thread_pool_set_user_data(
+    co_net_thread_pool_t* pool,
+    size_t index,
+    void* user_data
+);
+
+CO_NET_API
+void*
+co_net_pool_thread_get_user_data(
+    const co_thread_t* thread
+);
+
+CO_NET_API
+void
+co_net_thread_pool_get_stats(
+    const co_net_thread_pool_t* pool,
+    size_t index,
+    co_net_thread_pool_stats_st* stats
+);
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+CO_EXTERN_C_END
+
+#endif // CO_NET_THREAD_POOL_H_INCLUDED
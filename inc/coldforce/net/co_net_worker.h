@@ -1,6 +1,7 @@
 #ifndef CO_NET_WORKER_H_INCLUDED
 #define CO_NET_WORKER_H_INCLUDED
 
+#include <coldforce/core/co_atomic.h>
 #include <coldforce/core/co_list.h>
 #include <coldforce/core/co_event_worker.h>
 
@@ -37,6 +38,9 @@ typedef struct co_net_worker_t
     co_list_t* tcp_clients;
     co_list_t* udps;
 
+    // registered tcp clients and udps, readable from other threads
+    co_atomic_int_t connection_count;
+
     co_net_thread_callbacks_st callbacks;
     co_thread_destroy_fn on_destroy;
 
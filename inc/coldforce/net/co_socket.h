@@ -1,6 +1,7 @@
 #ifndef CO_SOCKET_H_INCLUDED
 #define CO_SOCKET_H_INCLUDED
 
+#include <coldforce/core/co_list.h>
 #include <coldforce/core/co_thread.h>
 
 #include <coldforce/net/co_net.h>
@@ -62,6 +63,9 @@ typedef struct co_socket_t
 
     co_timer_t* timer;
 
+    // node in the owner net worker's socket list (NULL if unregistered)
+    co_list_iterator_t* worker_it;
+
     void* sub_class;
     void* tls;
     void* user_data;
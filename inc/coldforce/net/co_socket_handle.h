@@ -39,6 +39,8 @@ typedef enum
 
 } co_socket_shutdown_t;
 
+#define CO_SOCKET_MAX_SEND_VEC_COUNT    64
+
 #endif // CO_OS_WIN
 
 //---------------------------------------------------------------------------//
@@ -112,6 +114,28 @@ co_socket_handle_receive(
     int flags
 );
 
+#ifndef CO_OS_WIN
+CO_NET_API
+ssize_t
+co_socket_handle_send_vec(
+    co_socket_handle_t handle,
+    const co_buffer_st* buffers,
+    size_t buffer_count,
+    int flags
+);
+
+// sends size bytes of the file from offset without copying
+// through user space, returns the sent size or -1
+CO_NET_API
+ssize_t
+co_socket_handle_send_file(
+    co_socket_handle_t handle,
+    int fd,
+    uint64_t offset,
+    size_t size
+);
+#endif
+
 CO_NET_API
 ssize_t
 co_socket_handle_send_to(
@@ -162,6 +162,26 @@ co_socket_option_get_reuse_port(
 
 #endif // SO_REUSEPORT
 
+// SO_INCOMING_CPU
+
+#ifdef SO_INCOMING_CPU
+
+CO_NET_API
+bool
+co_socket_option_set_incoming_cpu(
+    co_socket_t* sock,
+    int cpu
+);
+
+CO_NET_API
+bool
+co_socket_option_get_incoming_cpu(
+    const co_socket_t* sock,
+    int* cpu
+);
+
+#endif // SO_INCOMING_CPU
+
 // IP_ADD_MEMBERSHIP
 
 CO_NET_API
@@ -35,6 +35,18 @@ typedef void(*co_tcp_timer_fn)(
 typedef void(*co_tcp_connect_fn)(
     co_thread_t* self, struct co_tcp_client_t* client, int error_code);
 
+typedef void(*co_tcp_send_buffer_fn)(
+    co_thread_t* self, struct co_tcp_client_t* client, size_t buffered_size);
+
+#define CO_TCP_SEND_BUFFER_DEFAULT_LOW_WATERMARK    (64 * 1024)
+#define CO_TCP_SEND_BUFFER_DEFAULT_HIGH_WATERMARK   (256 * 1024)
+
+// least free space co_tcp_receive_all reads into
+#define CO_TCP_RECEIVE_ALL_MIN_SIZE                 8192
+
+// how long a closed client waits for its buffered data to go out
+#define CO_TCP_CLOSE_LINGER_TIMEOUT                 (30 * 1000)
+
 typedef struct
 {
     const void* data;
@@ -50,6 +62,8 @@ typedef struct
     co_tcp_receive_fn on_receive;
     co_tcp_timer_fn on_timer;
     co_tcp_close_fn on_close;
+    co_tcp_send_buffer_fn on_send_buffer_high;
+    co_tcp_send_buffer_fn on_send_buffer_low;
 
 } co_tcp_callbacks_st;
 
@@ -61,6 +75,31 @@ typedef struct co_tcp_client_t
     co_timer_t* close_timer;
     co_queue_t* send_async_queue;
 
+    struct co_tcp_send_buffer_t
+    {
+        co_byte_array_t* ptr;
+        size_t index;
+        size_t low_watermark;
+        size_t high_watermark;
+        bool high;
+
+    } send_buffer;
+
+    struct co_tcp_send_file_t
+    {
+        // -1 if no file is being sent
+        int fd;
+        uint64_t offset;
+        size_t size;
+
+        // buffered bytes that were queued before the file
+        size_t preceding_size;
+
+    } send_file;
+
+    bool receive_paused;
+    size_t max_receive_all_size;
+
 } co_tcp_client_t;
 
 typedef struct
@@ -69,6 +108,7 @@ typedef struct
     void (*close)(co_tcp_client_t*);
     bool (*connect)(co_tcp_client_t*, const co_net_addr_t*);
     bool (*send)(co_tcp_client_t*, const void*, size_t);
+    bool (*send_vec)(co_tcp_client_t*, const co_buffer_st*, size_t);
     ssize_t(*receive_all)(co_tcp_client_t*, co_byte_array_t*);
 
 } co_tcp_client_module_t;
@@ -105,6 +145,12 @@ void
 co_tcp_client_on_send_async_ready(
     co_tcp_client_t* client
 );
+
+// buffered data or a file is waiting for the socket
+bool
+co_tcp_client_is_send_pending(
+    const co_tcp_client_t* client
+);
 #endif
 
 void
@@ -113,6 +159,13 @@ co_tcp_client_on_send_async_complete(
     bool result
 );
 
+// reading stopped before the socket was drained
+CO_NET_API
+void
+co_tcp_client_continue_receive(
+    co_tcp_client_t* client
+);
+
 void
 co_tcp_client_on_receive_ready(
     co_tcp_client_t* client,
@@ -174,6 +227,37 @@ co_tcp_send(
     size_t data_size
 );
 
+CO_NET_API
+bool
+co_tcp_send_vec(
+    co_tcp_client_t* client,
+    const co_buffer_st* buffers,
+    size_t buffer_count
+);
+
+#ifndef CO_OS_WIN
+// sends size bytes of the file from offset with sendfile(2), after any
+// data already queued. on success the client owns fd and closes it when
+// the file is sent or the client is closed. the rest of the file is sent
+// as the socket becomes writable, and data sent meanwhile follows it.
+// fails, leaving fd to the caller, if a file is already being sent;
+// fd is closed on any other failure
+CO_NET_API
+bool
+co_tcp_send_file(
+    co_tcp_client_t* client,
+    int fd,
+    uint64_t offset,
+    size_t size
+);
+
+CO_NET_API
+bool
+co_tcp_is_sending_file(
+    const co_tcp_client_t* client
+);
+#endif
+
 CO_NET_API
 bool
 co_tcp_send_async(
@@ -183,6 +267,20 @@ co_tcp_send_async(
     void* user_data
 );
 
+CO_NET_API
+void
+co_tcp_set_send_buffer_watermark(
+    co_tcp_client_t* client,
+    size_t low_watermark,
+    size_t high_watermark
+);
+
+CO_NET_API
+size_t
+co_tcp_get_send_buffer_size(
+    const co_tcp_client_t* client
+);
+
 CO_NET_API
 ssize_t
 co_tcp_receive(
@@ -198,6 +296,39 @@ co_tcp_receive_all(
     co_byte_array_t* byte_array
 );
 
+// co_tcp_receive_all stops after about max_size bytes (default: no
+// limit) and on_receive is called again for the rest, so that a fast
+// peer can not grow the receive buffer without bound
+CO_NET_API
+void
+co_tcp_set_max_receive_all_size(
+    co_tcp_client_t* client,
+    size_t max_size
+);
+
+// stops reading the socket, so that the peer is held back by the tcp
+// window. on_receive is not called until co_tcp_resume_receive, and a
+// close by the peer is noticed after resuming
+CO_NET_API
+void
+co_tcp_pause_receive(
+    co_tcp_client_t* client
+);
+
+// restarts reading. on_receive is called once in any case, for the data
+// that the app left unprocessed when pausing
+CO_NET_API
+void
+co_tcp_resume_receive(
+    co_tcp_client_t* client
+);
+
+CO_NET_API
+bool
+co_tcp_is_receive_paused(
+    const co_tcp_client_t* client
+);
+
 CO_NET_API
 bool
 co_tcp_create_timer(
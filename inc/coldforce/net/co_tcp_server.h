@@ -16,6 +16,8 @@ CO_EXTERN_C_BEGIN
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+#define CO_TCP_SERVER_INCOMING_CPU_ANY  -1
+
 struct co_tcp_server_t;
 
 typedef void(*co_tcp_accept_fn)(
@@ -78,6 +80,14 @@ co_tcp_server_start(
     int backlog
 );
 
+CO_NET_API
+bool
+co_tcp_server_start_shared(
+    co_tcp_server_t* server,
+    int backlog,
+    int incoming_cpu
+);
+
 CO_NET_API
 bool
 co_tcp_accept(
@@ -17,6 +17,8 @@ CO_EXTERN_C_BEGIN
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+#define CO_TLS_SEND_VEC_GATHER_SIZE     1024
+
 //---------------------------------------------------------------------------//
 // public
 //---------------------------------------------------------------------------//
@@ -71,6 +73,14 @@ co_tls_tcp_send(
     size_t data_size
 );
 
+CO_TLS_API
+bool
+co_tls_tcp_send_vec(
+    co_tcp_client_t* tcp_client,
+    const co_buffer_st* buffers,
+    size_t buffer_count
+);
+
 CO_TLS_API
 bool
 co_tls_tcp_send_async(
@@ -1 +1,67 @@
+#include <coldforce/core/co_std.h>
 #include <coldforce/core/co.h>
+
+//---------------------------------------------------------------------------//
+// memory
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+static co_mem_allocator_st co_mem_allocator = { malloc, realloc, free };
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+void
+co_mem_set_allocator(
+    const co_mem_allocator_st* allocator
+)
+{
+    if ((allocator != NULL) &&
+        (allocator->alloc != NULL) &&
+        (allocator->realloc != NULL) &&
+        (allocator->free != NULL))
+    {
+        co_mem_allocator = *allocator;
+    }
+    else
+    {
+        co_mem_allocator.alloc = malloc;
+        co_mem_allocator.realloc = realloc;
+        co_mem_allocator.free = free;
+    }
+}
+
+void*
+co_mem_alloc(
+    size_t size
+)
+{
+    return co_mem_allocator.alloc(size);
+}
+
+void*
+co_mem_realloc(
+    void* mem,
+    size_t size
+)
+{
+    return co_mem_allocator.realloc(mem, size);
+}
+
+void
+co_mem_free(
+    void* mem
+)
+{
+    co_mem_allocator.free(mem);
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
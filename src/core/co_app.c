@@ -1,6 +1,7 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_app.h>
 #include <coldforce/core/co_log.h>
+#include <coldforce/core/co_mem_pool.h>
 
 #ifdef CO_OS_WIN
 #   include <windows.h>
@@ -103,6 +104,8 @@ co_app_run(
         "app [%08lx] start",
         app->main_thread.id);
 
+    co_mem_pool_setup_thread();
+
     bool create_result = true;
 
     if (app->main_thread.on_create != NULL)
@@ -121,6 +124,8 @@ co_app_run(
         app->main_thread.on_destroy((co_thread_t*)app);
     }
 
+    co_mem_pool_cleanup_thread();
+
     co_core_log_info(
         "app [%08lx] exit: (%d)",
         app->main_thread.id,
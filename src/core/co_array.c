@@ -201,3 +201,54 @@ co_array_zero_clear(
     memset(arr->buffer, 0x00,
         arr->element_size * arr->count);
 }
+
+size_t
+co_array_get_capacity(
+    const co_array_t* arr
+)
+{
+    return arr->capacity;
+}
+
+void
+co_array_remove(
+    co_array_t* arr,
+    size_t index,
+    size_t count
+)
+{
+    co_assert(index + count <= arr->count);
+
+    memmove(&arr->buffer[index * arr->element_size],
+        &arr->buffer[(index + count) * arr->element_size],
+        (arr->count - index - count) * arr->element_size);
+
+    arr->count -= count;
+}
+
+void
+co_array_shrink(
+    co_array_t* arr,
+    size_t capacity
+)
+{
+    // set_count needs a spare element
+    if (capacity <= arr->count)
+    {
+        capacity = arr->count + 1;
+    }
+
+    if (capacity >= arr->capacity)
+    {
+        return;
+    }
+
+    void* new_buffer =
+        co_mem_realloc(arr->buffer, arr->element_size * capacity);
+
+    if (new_buffer != NULL)
+    {
+        arr->capacity = capacity;
+        arr->buffer = (uint8_t*)new_buffer;
+    }
+}
@@ -1,6 +1,11 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_event_worker.h>
 #include <coldforce/core/co_thread.h>
+#include <coldforce/core/co_mem_pool.h>
+
+#ifndef CO_OS_WIN
+#include <sched.h>
+#endif
 
 //---------------------------------------------------------------------------//
 // event worker
@@ -28,9 +33,13 @@ co_event_worker_create(
 
     event_worker->running = false;
     event_worker->stop_receiving = true;
+    event_worker->producer_count = 0;
 
-    event_worker->event_queue = NULL;
-    event_worker->event_queue_mutex = NULL;
+    event_worker->event_stack = NULL;
+    event_worker->local_event_queue = NULL;
+    event_worker->sleeping = false;
+    event_worker->wake_up_count = 0;
+    event_worker->wake_up_suppressed_count = 0;
     event_worker->event_handler_map = NULL;
     event_worker->timer_manager = NULL;
     event_worker->wait_semaphore = NULL;
@@ -58,10 +67,14 @@ co_event_worker_setup(
 {
     event_worker->running = true;
     event_worker->stop_receiving = false;
+    event_worker->producer_count = 0;
 
-    event_worker->event_queue =
+    event_worker->event_stack = NULL;
+    event_worker->local_event_queue =
         co_queue_create(sizeof(co_event_st), NULL);
-    event_worker->event_queue_mutex = co_mutex_create();
+    event_worker->sleeping = false;
+    event_worker->wake_up_count = 0;
+    event_worker->wake_up_suppressed_count = 0;
     event_worker->event_handler_map = co_map_create(NULL);
     event_worker->wait_semaphore = co_semaphore_create(0);
     event_worker->timer_manager = co_timer_manager_create();
@@ -97,6 +110,8 @@ co_event_worker_cleanup(
     co_event_worker_t* event_worker
 )
 {
+    co_event_worker_stop_receiving(event_worker);
+
     co_timer_manager_destroy(event_worker->timer_manager);
     event_worker->timer_manager = NULL;
 
@@ -106,11 +121,20 @@ co_event_worker_cleanup(
     co_map_destroy(event_worker->event_handler_map);
     event_worker->event_handler_map = NULL;
 
-    co_mutex_destroy(event_worker->event_queue_mutex);
-    event_worker->event_queue_mutex = NULL;
+    co_event_node_t* node = (co_event_node_t*)
+        co_atomic_exchange_ptr(&event_worker->event_stack, NULL);
+
+    while (node != NULL)
+    {
+        co_event_node_t* next = node->next;
+
+        co_mem_pool_free(node);
+
+        node = next;
+    }
 
-    co_queue_destroy(event_worker->event_queue);
-    event_worker->event_queue = NULL;
+    co_queue_destroy(event_worker->local_event_queue);
+    event_worker->local_event_queue = NULL;
 
     co_list_destroy(event_worker->mem_trash);
     event_worker->mem_trash = NULL;
@@ -142,6 +166,70 @@ co_mem_free_later(
     }
 }
 
+static bool
+co_event_worker_is_current(
+    const co_event_worker_t* event_worker
+)
+{
+    const co_thread_t* thread = co_thread_get_current();
+
+    return ((thread != NULL) &&
+        (thread->event_worker == event_worker));
+}
+
+static bool
+co_event_worker_add_local(
+    co_event_worker_t* event_worker,
+    const co_event_st* event
+)
+{
+    // owner thread only: no lock and no wake up needed,
+    // the run loop drains this queue before it waits again
+
+    if (!event_worker->running)
+    {
+        return false;
+    }
+
+    return co_queue_push(event_worker->local_event_queue, event);
+}
+
+static co_event_node_t*
+co_event_worker_take_all(
+    co_event_worker_t* event_worker
+)
+{
+    co_event_node_t* node = (co_event_node_t*)
+        co_atomic_exchange_ptr(&event_worker->event_stack, NULL);
+
+    // the stack is newest first, reverse it into arrival order
+
+    co_event_node_t* head = NULL;
+
+    while (node != NULL)
+    {
+        co_event_node_t* next = node->next;
+
+        node->next = head;
+        head = node;
+
+        node = next;
+    }
+
+    return head;
+}
+
+static bool
+co_event_worker_pump_local(
+    co_event_worker_t* event_worker,
+    co_event_st* event
+)
+{
+    co_event_worker_check_timer(event_worker);
+
+    return co_queue_pop(event_worker->local_event_queue, event);
+}
+
 void
 co_event_worker_run(
     co_event_worker_t* event_worker
@@ -149,50 +237,71 @@ co_event_worker_run(
 {
     while (event_worker->running)
     {
-        uint32_t msec =
-            co_timer_manager_get_next_timeout(event_worker->timer_manager);
+        uint32_t msec = 0;
+
+        if (co_queue_get_count(event_worker->local_event_queue) == 0)
+        {
+            msec = co_timer_manager_get_next_timeout(
+                event_worker->timer_manager);
+        }
+
+        // announce the sleep before the last look at the event stack,
+        // a producer either sees the flag or its event is seen here
+
+        co_atomic_store(&event_worker->sleeping, true);
+
+        if (co_atomic_load_ptr(&event_worker->event_stack) != NULL)
+        {
+            msec = 0;
+        }
 
         co_wait_result_t result = event_worker->wait(event_worker, msec);
 
+        co_atomic_store(&event_worker->sleeping, false);
+
         if (result == CO_WAIT_RESULT_ERROR)
         {
             break;
         }
 
         co_event_worker_check_timer(event_worker);
-        
-        long event_count =
-            (long)co_event_worker_get_event_count(event_worker);
 
+        bool dispatched = false;
         co_event_st event = { 0 };
 
+        long event_count =
+            (long)co_queue_get_count(event_worker->local_event_queue);
+
         while ((event_count > 0) &&
-            co_event_worker_pump(event_worker, &event))
+            co_event_worker_pump_local(event_worker, &event))
         {
             event_worker->dispatch(event_worker, &event);
+            dispatched = true;
 
             --event_count;
         }
 
-        if (event.id == 0)
+        co_event_node_t* node = co_event_worker_take_all(event_worker);
+
+        while (node != NULL)
         {
-            event_worker->on_idle(event_worker);
-        }
-    }
-}
+            co_event_node_t* next = node->next;
 
-size_t
-co_event_worker_get_event_count(
-    co_event_worker_t* event_worker
-)
-{
-    co_mutex_lock(event_worker->event_queue_mutex);
+            co_event_worker_check_timer(event_worker);
 
-    size_t count = co_queue_get_count(event_worker->event_queue);
+            event_worker->dispatch(event_worker, &node->event);
+            dispatched = true;
 
-    co_mutex_unlock(event_worker->event_queue_mutex);
+            co_mem_pool_free(node);
+
+            node = next;
+        }
 
-    return count;
+        if (!dispatched)
+        {
+            event_worker->on_idle(event_worker);
+        }
+    }
 }
 
 co_wait_result_t
@@ -291,53 +400,110 @@ co_event_worker_on_idle(
     }
 }
 
-bool
-co_event_worker_add(
+static bool
+co_event_worker_push(
     co_event_worker_t* event_worker,
     const co_event_st* event
 )
 {
-    bool result = false;
+    if (co_atomic_load(&event_worker->stop_receiving))
+    {
+        return false;
+    }
+
+    if ((event->id == CO_EVENT_ID_STOP) &&
+        co_atomic_exchange(&event_worker->stop_receiving, true))
+    {
+        return false;
+    }
 
-    co_mutex_lock(event_worker->event_queue_mutex);
+    co_event_node_t* node =
+        (co_event_node_t*)co_mem_pool_alloc(sizeof(co_event_node_t));
 
-    if (!event_worker->stop_receiving)
+    if (node == NULL)
     {
-        if (event->id == CO_EVENT_ID_STOP)
+        return false;
+    }
+
+    node->event = *event;
+
+    void* head = co_atomic_load_ptr(&event_worker->event_stack);
+
+    for (;;)
+    {
+        node->next = (co_event_node_t*)head;
+
+        void* prev = co_atomic_compare_exchange_ptr(
+            &event_worker->event_stack, head, node);
+
+        if (prev == head)
         {
-            event_worker->stop_receiving = true;
+            break;
         }
 
-        co_queue_push(event_worker->event_queue, event);
+        head = prev;
+    }
+
+    // only the producer that clears the sleeping flag wakes the owner,
+    // a running owner drains the stack before it waits again
 
+    if (co_atomic_exchange(&event_worker->sleeping, false))
+    {
         event_worker->wake_up(event_worker);
 
-        result = true;
+        co_atomic_increment(&event_worker->wake_up_count);
+    }
+    else
+    {
+        co_atomic_increment(&event_worker->wake_up_suppressed_count);
     }
 
-    co_mutex_unlock(event_worker->event_queue_mutex);
-
-    return result;
+    return true;
 }
 
 bool
-co_event_worker_pump(
+co_event_worker_add(
     co_event_worker_t* event_worker,
-    co_event_st* event
+    const co_event_st* event
 )
 {
-    co_event_worker_check_timer(event_worker);
+    if ((event->id != CO_EVENT_ID_STOP) &&
+        co_event_worker_is_current(event_worker))
+    {
+        return co_event_worker_add_local(event_worker, event);
+    }
 
-    co_mutex_lock(event_worker->event_queue_mutex);
+    // counted before the stop check, so that the owner can wait
+    // for the producers that passed it (co_event_worker_stop_receiving)
 
-    bool result =
-        co_queue_pop(event_worker->event_queue, event);
+    co_atomic_increment(&event_worker->producer_count);
 
-    co_mutex_unlock(event_worker->event_queue_mutex);
+    bool result = co_event_worker_push(event_worker, event);
+
+    co_atomic_decrement(&event_worker->producer_count);
 
     return result;
 }
 
+void
+co_event_worker_stop_receiving(
+    co_event_worker_t* event_worker
+)
+{
+    co_atomic_store(&event_worker->stop_receiving, true);
+
+    // a producer either sees the flag or is counted here
+
+    while (co_atomic_load(&event_worker->producer_count) != 0)
+    {
+#ifdef CO_OS_WIN
+        SwitchToThread();
+#else
+        sched_yield();
+#endif
+    }
+}
+
 bool
 co_event_worker_register_timer(
     co_event_worker_t* event_worker,
@@ -373,7 +539,7 @@ co_event_worker_unregister_timer(
         };
 
         co_event_st* queued_event = (co_event_st*)
-            co_queue_find(event_worker->event_queue,
+            co_queue_find(event_worker->local_event_queue,
                 &timer_event, (co_item_compare_fn)co_compare_event);
         co_assert(queued_event != NULL);
 
@@ -413,3 +579,22 @@ co_event_worker_check_timer(
         msec = co_timer_manager_get_next_timeout(event_worker->timer_manager);
     }
 }
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+void
+co_event_worker_get_stats(
+    const co_event_worker_t* event_worker,
+    co_event_worker_stats_st* stats
+)
+{
+    stats->wake_up_count =
+        (size_t)co_atomic_load(&event_worker->wake_up_count);
+    stats->wake_up_suppressed_count =
+        (size_t)co_atomic_load(&event_worker->wake_up_suppressed_count);
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
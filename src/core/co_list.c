@@ -1,5 +1,6 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_list.h>
+#include <coldforce/core/co_mem_pool.h>
 
 //---------------------------------------------------------------------------//
 // list
@@ -47,7 +48,7 @@ co_list_create(
 )
 {
     co_list_t* list =
-        (co_list_t*)co_mem_alloc(sizeof(co_list_t));
+        (co_list_t*)co_mem_pool_alloc(sizeof(co_list_t));
 
     if (list == NULL)
     {
@@ -97,7 +98,7 @@ co_list_destroy(
     if (list != NULL)
     {
         co_list_clear(list);
-        co_mem_free(list);
+        co_mem_pool_free(list);
     }
 }
 
@@ -115,7 +116,7 @@ co_list_clear(
 
         list->destroy_value(temp->data.value);
 
-        co_mem_free(temp);
+        co_mem_pool_free(temp);
     }
 
     list->count = 0;
@@ -159,7 +160,7 @@ co_list_add_head(
 )
 {
     co_list_item_t* new_item =
-        (co_list_item_t*)co_mem_alloc(sizeof(co_list_item_t));
+        (co_list_item_t*)co_mem_pool_alloc(sizeof(co_list_item_t));
 
     if (new_item == NULL)
     {
@@ -194,7 +195,7 @@ co_list_add_tail(
 )
 {
     co_list_item_t* new_item =
-        (co_list_item_t*)co_mem_alloc(sizeof(co_list_item_t));
+        (co_list_item_t*)co_mem_pool_alloc(sizeof(co_list_item_t));
 
     if (new_item == NULL)
     {
@@ -271,7 +272,7 @@ co_list_remove_head(
             list->head->prev = NULL;
         }
 
-        co_mem_free(item);
+        co_mem_pool_free(item);
 
         --list->count;
 
@@ -300,7 +301,7 @@ co_list_remove_tail(
             list->tail->next = NULL;
         }
 
-        co_mem_free(item);
+        co_mem_pool_free(item);
 
         --list->count;
 
@@ -347,7 +348,7 @@ co_list_remove_at(
 
         list->destroy_value(iterator->data.value);
 
-        co_mem_free(iterator);
+        co_mem_pool_free(iterator);
 
         --list->count;
     }
@@ -437,7 +438,7 @@ co_list_insert(
 )
 {
     co_list_item_t* new_item =
-        (co_list_item_t*)co_mem_alloc(sizeof(co_list_item_t));
+        (co_list_item_t*)co_mem_pool_alloc(sizeof(co_list_item_t));
 
     if (new_item == NULL)
     {
@@ -472,7 +473,7 @@ co_list_insert_after(
 )
 {
     co_list_item_t* new_item =
-        (co_list_item_t*)co_mem_alloc(sizeof(co_list_item_t));
+        (co_list_item_t*)co_mem_pool_alloc(sizeof(co_list_item_t));
 
     if (new_item == NULL)
     {
@@ -1,5 +1,6 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_map.h>
+#include <coldforce/core/co_mem_pool.h>
 
 //---------------------------------------------------------------------------//
 // map
@@ -170,7 +171,7 @@ co_map_clear(
                 co_map_item_t* temp = item;
                 item = item->next;
 
-                co_mem_free(temp);
+                co_mem_pool_free(temp);
 
             } while (item != NULL);
         }
@@ -235,7 +236,7 @@ co_map_set(
     }
 
     (*item) = (co_map_item_t*)
-        co_mem_alloc(sizeof(co_map_item_t));
+        co_mem_pool_alloc(sizeof(co_map_item_t));
 
     if ((*item) == NULL)
     {
@@ -301,7 +302,7 @@ co_map_remove(
             map->destroy_key(item->data.key);
             map->destroy_value(item->data.value);
 
-            co_mem_free(item);
+            co_mem_pool_free(item);
 
             --map->count;
 
@@ -0,0 +1,238 @@
+#include <coldforce/core/co_std.h>
+#include <coldforce/core/co_mem_pool.h>
+
+//---------------------------------------------------------------------------//
+// memory pool
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+#define CO_MEM_POOL_CLASS_NONE  0xFF
+
+// keeps the user pointer aligned like malloc
+typedef union co_mem_pool_block_t
+{
+    struct
+    {
+        size_t class_index;
+        union co_mem_pool_block_t* next;
+
+    } header;
+
+    long double align_ld;
+    void* align_ptr;
+    uint64_t align_u64;
+
+} co_mem_pool_block_t;
+
+typedef struct
+{
+    co_mem_pool_block_t* free_list;
+    size_t free_count;
+
+} co_mem_pool_class_t;
+
+typedef struct
+{
+    co_mem_pool_class_t classes[CO_MEM_POOL_CLASS_COUNT];
+    co_mem_pool_stats_st stats;
+
+} co_mem_pool_t;
+
+static const size_t co_mem_pool_class_sizes[CO_MEM_POOL_CLASS_COUNT] =
+{
+    32, 64, 128, 256, CO_MEM_POOL_MAX_BLOCK_SIZE
+};
+
+static CO_THREAD_LOCAL co_mem_pool_t* current_mem_pool = NULL;
+
+static size_t
+co_mem_pool_get_class_index(
+    size_t size
+)
+{
+    for (size_t index = 0; index < CO_MEM_POOL_CLASS_COUNT; ++index)
+    {
+        if (size <= co_mem_pool_class_sizes[index])
+        {
+            return index;
+        }
+    }
+
+    return CO_MEM_POOL_CLASS_NONE;
+}
+
+void
+co_mem_pool_setup_thread(
+    void
+)
+{
+    if (current_mem_pool != NULL)
+    {
+        return;
+    }
+
+    co_mem_pool_t* pool =
+        (co_mem_pool_t*)co_mem_alloc(sizeof(co_mem_pool_t));
+
+    if (pool != NULL)
+    {
+        memset(pool, 0x00, sizeof(co_mem_pool_t));
+
+        current_mem_pool = pool;
+    }
+}
+
+void
+co_mem_pool_cleanup_thread(
+    void
+)
+{
+    co_mem_pool_t* pool = current_mem_pool;
+
+    if (pool == NULL)
+    {
+        return;
+    }
+
+    current_mem_pool = NULL;
+
+    for (size_t index = 0; index < CO_MEM_POOL_CLASS_COUNT; ++index)
+    {
+        co_mem_pool_block_t* block = pool->classes[index].free_list;
+
+        while (block != NULL)
+        {
+            co_mem_pool_block_t* next = block->header.next;
+
+            co_mem_free(block);
+
+            block = next;
+        }
+    }
+
+    co_mem_free(pool);
+}
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+void*
+co_mem_pool_alloc(
+    size_t size
+)
+{
+    co_mem_pool_t* pool = current_mem_pool;
+    const size_t class_index = co_mem_pool_get_class_index(size);
+
+    if (pool != NULL)
+    {
+        ++pool->stats.alloc_count;
+
+        if (class_index != CO_MEM_POOL_CLASS_NONE)
+        {
+            co_mem_pool_class_t* pool_class = &pool->classes[class_index];
+            co_mem_pool_block_t* block = pool_class->free_list;
+
+            if (block != NULL)
+            {
+                pool_class->free_list = block->header.next;
+                --pool_class->free_count;
+
+                --pool->stats.cached_count;
+                pool->stats.cached_size -=
+                    co_mem_pool_class_sizes[class_index];
+
+                return block + 1;
+            }
+        }
+
+        ++pool->stats.heap_alloc_count;
+    }
+
+    // blocks of a size class are allocated at the full class size
+    // so that any thread can recycle them
+    const size_t block_size =
+        (class_index != CO_MEM_POOL_CLASS_NONE) ?
+            co_mem_pool_class_sizes[class_index] : size;
+
+    co_mem_pool_block_t* block = (co_mem_pool_block_t*)co_mem_alloc(
+        sizeof(co_mem_pool_block_t) + block_size);
+
+    if (block == NULL)
+    {
+        return NULL;
+    }
+
+    block->header.class_index = class_index;
+    block->header.next = NULL;
+
+    return block + 1;
+}
+
+void
+co_mem_pool_free(
+    void* mem
+)
+{
+    if (mem == NULL)
+    {
+        return;
+    }
+
+    co_mem_pool_block_t* block = ((co_mem_pool_block_t*)mem) - 1;
+    co_mem_pool_t* pool = current_mem_pool;
+
+    if (pool != NULL)
+    {
+        ++pool->stats.free_count;
+
+        const size_t class_index = block->header.class_index;
+
+        if (class_index != CO_MEM_POOL_CLASS_NONE)
+        {
+            co_mem_pool_class_t* pool_class = &pool->classes[class_index];
+
+            if (pool_class->free_count < CO_MEM_POOL_MAX_CACHED_COUNT)
+            {
+                block->header.next = pool_class->free_list;
+                pool_class->free_list = block;
+                ++pool_class->free_count;
+
+                ++pool->stats.cached_count;
+                pool->stats.cached_size +=
+                    co_mem_pool_class_sizes[class_index];
+
+                return;
+            }
+        }
+
+        ++pool->stats.heap_free_count;
+    }
+
+    co_mem_free(block);
+}
+
+void
+co_mem_pool_get_stats(
+    co_mem_pool_stats_st* stats
+)
+{
+    if (current_mem_pool != NULL)
+    {
+        *stats = current_mem_pool->stats;
+    }
+    else
+    {
+        memset(stats, 0x00, sizeof(co_mem_pool_stats_st));
+    }
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
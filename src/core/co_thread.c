@@ -1,13 +1,19 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#   define _GNU_SOURCE
+#endif
+
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_thread.h>
 #include <coldforce/core/co_string.h>
 #include <coldforce/core/co_log.h>
+#include <coldforce/core/co_mem_pool.h>
 
 #ifdef CO_OS_WIN
 #   include <windows.h>
 #   include <process.h>
 #else
 #   include <pthread.h>
+#   include <sched.h>
 #   include <sys/syscall.h>
 #   include <sys/types.h>
 #   include <errno.h>
@@ -50,6 +56,8 @@ co_thread_main(
     co_assert(current_thread == NULL);
     current_thread = thread;
 
+    co_mem_pool_setup_thread();
+
 #ifdef CO_OS_WIN
     thread->id = GetCurrentThreadId();
 #else
@@ -83,6 +91,8 @@ co_thread_main(
         thread->on_destroy(thread);
     }
 
+    co_mem_pool_cleanup_thread();
+
     co_core_log_info(
         "thread [%08lx] exit: (%d)", thread->id, thread->exit_code);
 
@@ -275,6 +285,48 @@ co_thread_set_exit_code(
     thread->exit_code = exit_code;
 }
 
+bool
+co_thread_set_cpu_affinity(
+    int cpu
+)
+{
+    if (cpu < 0)
+    {
+        return false;
+    }
+
+#ifdef CO_OS_WIN
+
+    if (cpu >= (int)(sizeof(DWORD_PTR) * 8))
+    {
+        return false;
+    }
+
+    return (SetThreadAffinityMask(
+        GetCurrentThread(), ((DWORD_PTR)1) << cpu) != 0);
+
+#elif defined(CO_OS_LINUX)
+
+    if (cpu >= CPU_SETSIZE)
+    {
+        return false;
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+
+    return (pthread_setaffinity_np(
+        pthread_self(), sizeof(cpu_set), &cpu_set) == 0);
+
+#else
+
+    // not supported
+    return false;
+
+#endif
+}
+
 int
 co_thread_get_exit_code(
     const co_thread_t* thread
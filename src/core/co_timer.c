@@ -1,6 +1,7 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_timer.h>
 #include <coldforce/core/co_thread.h>
+#include <coldforce/core/co_mem_pool.h>
 
 //---------------------------------------------------------------------------//
 // timer
@@ -22,7 +23,7 @@ co_timer_create(
 )
 {
     co_timer_t* timer =
-        (co_timer_t*)co_mem_alloc(sizeof(co_timer_t));
+        (co_timer_t*)co_mem_pool_alloc(sizeof(co_timer_t));
 
     if (timer == NULL)
     {
@@ -36,6 +37,7 @@ co_timer_create(
     timer->msec = msec;
     timer->handler = handler;
     timer->user_data = user_data;
+    timer->heap_index = CO_TIMER_INVALID_INDEX;
 
     return timer;
 }
@@ -48,7 +50,7 @@ co_timer_destroy(
     if (timer != NULL)
     {
         co_timer_stop(timer);
-        co_mem_free(timer);
+        co_mem_pool_free(timer);
     }
 }
 
@@ -9,10 +9,146 @@
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+#define CO_TIMER_MANAGER_DEFAULT_CAPACITY   64
+#define CO_TIMER_HEAP_ARITY                 4
+
 //---------------------------------------------------------------------------//
 // private
 //---------------------------------------------------------------------------//
 
+static bool
+co_timer_item_is_before(
+    const co_timer_item_t* item1,
+    const co_timer_item_t* item2
+)
+{
+    if (item1->end != item2->end)
+    {
+        return (item1->end < item2->end);
+    }
+
+    // same expiry: first registered, first fired
+
+    return (item1->seq < item2->seq);
+}
+
+static void
+co_timer_manager_set_item(
+    co_timer_manager_t* timer_manager,
+    size_t index,
+    const co_timer_item_t* item
+)
+{
+    timer_manager->items[index] = *item;
+    item->timer->heap_index = index;
+}
+
+static void
+co_timer_manager_sift_up(
+    co_timer_manager_t* timer_manager,
+    size_t index
+)
+{
+    co_timer_item_t item = timer_manager->items[index];
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / CO_TIMER_HEAP_ARITY;
+
+        if (!co_timer_item_is_before(
+            &item, &timer_manager->items[parent]))
+        {
+            break;
+        }
+
+        co_timer_manager_set_item(
+            timer_manager, index, &timer_manager->items[parent]);
+
+        index = parent;
+    }
+
+    co_timer_manager_set_item(timer_manager, index, &item);
+}
+
+static void
+co_timer_manager_sift_down(
+    co_timer_manager_t* timer_manager,
+    size_t index
+)
+{
+    co_timer_item_t item = timer_manager->items[index];
+
+    for (;;)
+    {
+        size_t first_child = index * CO_TIMER_HEAP_ARITY + 1;
+
+        if (first_child >= timer_manager->count)
+        {
+            break;
+        }
+
+        size_t last_child =
+            co_min(first_child + CO_TIMER_HEAP_ARITY,
+                timer_manager->count);
+        size_t min_child = first_child;
+
+        for (size_t child = first_child + 1;
+            child < last_child; ++child)
+        {
+            if (co_timer_item_is_before(
+                &timer_manager->items[child],
+                &timer_manager->items[min_child]))
+            {
+                min_child = child;
+            }
+        }
+
+        if (!co_timer_item_is_before(
+            &timer_manager->items[min_child], &item))
+        {
+            break;
+        }
+
+        co_timer_manager_set_item(
+            timer_manager, index, &timer_manager->items[min_child]);
+
+        index = min_child;
+    }
+
+    co_timer_manager_set_item(timer_manager, index, &item);
+}
+
+static void
+co_timer_manager_remove_at(
+    co_timer_manager_t* timer_manager,
+    size_t index
+)
+{
+    timer_manager->items[index].timer->heap_index = CO_TIMER_INVALID_INDEX;
+
+    --timer_manager->count;
+
+    if (index == timer_manager->count)
+    {
+        return;
+    }
+
+    co_timer_manager_set_item(timer_manager, index,
+        &timer_manager->items[timer_manager->count]);
+
+    if ((index > 0) &&
+        co_timer_item_is_before(
+            &timer_manager->items[index],
+            &timer_manager->items[(index - 1) / CO_TIMER_HEAP_ARITY]))
+    {
+        co_timer_manager_sift_up(timer_manager, index);
+    }
+    else
+    {
+        co_timer_manager_sift_down(timer_manager, index);
+    }
+}
+
 co_timer_manager_t*
 co_timer_manager_create(
     void
@@ -26,10 +162,20 @@ co_timer_manager_create(
         return NULL;
     }
 
-    co_list_ctx_st ctx = { 0 };
-    ctx.destroy_value = (co_item_destroy_fn)co_mem_free;
+    timer_manager->items =
+        (co_timer_item_t*)co_mem_alloc(
+            sizeof(co_timer_item_t) * CO_TIMER_MANAGER_DEFAULT_CAPACITY);
+
+    if (timer_manager->items == NULL)
+    {
+        co_mem_free(timer_manager);
+
+        return NULL;
+    }
 
-    timer_manager->timers = co_list_create(&ctx);
+    timer_manager->count = 0;
+    timer_manager->capacity = CO_TIMER_MANAGER_DEFAULT_CAPACITY;
+    timer_manager->seq = 0;
 
     return timer_manager;
 }
@@ -40,8 +186,8 @@ co_timer_manager_destroy(
 )
 {
     co_timer_manager_clear(timer_manager);
-    co_list_destroy(timer_manager->timers);
 
+    co_mem_free(timer_manager->items);
     co_mem_free(timer_manager);
 }
 
@@ -50,7 +196,13 @@ co_timer_manager_clear(
     co_timer_manager_t* timer_manager
 )
 {
-    co_list_clear(timer_manager->timers);
+    for (size_t index = 0; index < timer_manager->count; ++index)
+    {
+        timer_manager->items[index].timer->heap_index =
+            CO_TIMER_INVALID_INDEX;
+    }
+
+    timer_manager->count = 0;
 }
 
 bool
@@ -59,37 +211,33 @@ co_timer_manager_register(
     co_timer_t* timer
 )
 {
-    co_timer_item_t* new_item =
-        (co_timer_item_t*)co_mem_alloc(sizeof(co_timer_item_t));
-
-    if (new_item == NULL)
+    if (timer_manager->count == timer_manager->capacity)
     {
-        return false;
-    }
-
-    new_item->end = co_get_current_time_in_msec() + timer->msec;
-    new_item->timer = timer;
-
-    co_list_iterator_t* it =
-        co_list_get_head_iterator(timer_manager->timers);
+        size_t new_capacity = timer_manager->capacity * 2;
 
-    while (it != NULL)
-    {
-        const co_list_data_st* data =
-            co_list_get(timer_manager->timers, it);
+        co_timer_item_t* new_items =
+            (co_timer_item_t*)co_mem_realloc(timer_manager->items,
+                sizeof(co_timer_item_t) * new_capacity);
 
-        if (((co_timer_item_t*)data->value)->end > new_item->end)
+        if (new_items == NULL)
         {
-            co_list_insert(
-                timer_manager->timers, it, new_item);
-
-            return true;
+            return false;
         }
 
-        it = co_list_get_next_iterator(timer_manager->timers, it);
+        timer_manager->items = new_items;
+        timer_manager->capacity = new_capacity;
     }
 
-    co_list_add_tail(timer_manager->timers, new_item);
+    co_timer_item_t new_item;
+
+    new_item.timer = timer;
+    new_item.end = co_get_current_time_in_msec() + timer->msec;
+    new_item.seq = timer_manager->seq++;
+
+    size_t index = timer_manager->count++;
+
+    co_timer_manager_set_item(timer_manager, index, &new_item);
+    co_timer_manager_sift_up(timer_manager, index);
 
     return true;
 }
@@ -100,25 +248,17 @@ co_timer_manager_unregister(
     co_timer_t* timer
 )
 {
-    co_list_iterator_t* it =
-        co_list_get_head_iterator(timer_manager->timers);
+    size_t index = timer->heap_index;
 
-    while (it != NULL)
+    if ((index >= timer_manager->count) ||
+        (timer_manager->items[index].timer != timer))
     {
-        const co_list_data_st* data =
-            co_list_get(timer_manager->timers, it);
-
-        if (((co_timer_item_t*)data->value)->timer == timer)
-        {
-            co_list_remove_at(timer_manager->timers, it);
-
-            return true;
-        }
-
-        it = co_list_get_next_iterator(timer_manager->timers, it);
+        return false;
     }
 
-    return false;
+    co_timer_manager_remove_at(timer_manager, index);
+
+    return true;
 }
 
 uint32_t
@@ -126,19 +266,14 @@ co_timer_manager_get_next_timeout(
     co_timer_manager_t* timer_manager
 )
 {
-    if (co_list_get_count(timer_manager->timers) == 0)
+    if (timer_manager->count == 0)
     {
         return CO_INFINITE;
     }
     else
     {
         uint64_t now = co_get_current_time_in_msec();
-
-        const co_list_data_st* data =
-            co_list_get_head(timer_manager->timers);
-
-        uint64_t end =
-            ((const co_timer_item_t*)data->value)->end;
+        uint64_t end = timer_manager->items[0].end;
 
         if (now >= end)
         {
@@ -156,17 +291,14 @@ co_timer_manager_remove_head_timer(
     co_timer_manager_t* timer_manager
 )
 {
-    co_timer_t* timer = NULL;
-
-    const co_list_data_st* data =
-        co_list_get_head(timer_manager->timers);
-
-    if (data != NULL)
+    if (timer_manager->count == 0)
     {
-        timer = ((co_timer_item_t*)data->value)->timer;
-
-        co_list_remove_head(timer_manager->timers);
+        return NULL;
     }
 
+    co_timer_t* timer = timer_manager->items[0].timer;
+
+    co_timer_manager_remove_at(timer_manager, 0);
+
     return timer;
 }
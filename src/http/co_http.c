@@ -1,3 +1,162 @@
 ﻿#include <coldforce/core/co_std.h>
 
 #include <coldforce/http/co_http.h>
+
+#include <time.h>
+
+#ifdef CO_OS_WIN
+#   define co_http_gmtime(t, tm) gmtime_s((tm), (t))
+#else
+#   define co_http_gmtime(t, tm) gmtime_r((t), (tm))
+#endif
+
+//---------------------------------------------------------------------------//
+// http
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+static const char* const co_http_day_names[7] =
+{
+    "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"
+};
+
+static const char* const co_http_month_names[12] =
+{
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+    "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+static CO_THREAD_LOCAL time_t co_http_date_time = 0;
+static CO_THREAD_LOCAL char co_http_date[CO_HTTP_DATE_LENGTH + 1];
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+static bool
+co_http_parse_date_number(
+    const char* str,
+    size_t digit_count,
+    int* value
+)
+{
+    *value = 0;
+
+    for (size_t index = 0; index < digit_count; ++index)
+    {
+        if ((str[index] < '0') || (str[index] > '9'))
+        {
+            return false;
+        }
+
+        *value = (*value * 10) + (str[index] - '0');
+    }
+
+    return true;
+}
+
+void
+co_http_format_date(
+    int64_t unix_time,
+    char* buffer
+)
+{
+    const time_t t = (time_t)unix_time;
+
+    struct tm tm;
+    co_http_gmtime(&t, &tm);
+
+    // not strftime, which follows the locale
+    snprintf(buffer, CO_HTTP_DATE_LENGTH + 1,
+        "%s, %02u %s %04u %02u:%02u:%02u GMT",
+        co_http_day_names[tm.tm_wday % 7],
+        (unsigned int)tm.tm_mday % 100,
+        co_http_month_names[tm.tm_mon % 12],
+        (unsigned int)(tm.tm_year + 1900) % 10000,
+        (unsigned int)tm.tm_hour % 100,
+        (unsigned int)tm.tm_min % 100,
+        (unsigned int)tm.tm_sec % 100);
+}
+
+bool
+co_http_parse_date(
+    const char* str,
+    int64_t* unix_time
+)
+{
+    // "Sun, 06 Nov 1994 08:49:37 GMT"
+
+    if ((strlen(str) != CO_HTTP_DATE_LENGTH) ||
+        (str[3] != ',') || (str[4] != ' ') || (str[7] != ' ') ||
+        (str[11] != ' ') || (str[16] != ' ') || (str[19] != ':') ||
+        (str[22] != ':') || (strcmp(&str[25], " GMT") != 0))
+    {
+        return false;
+    }
+
+    int month = 0;
+
+    while ((month < 12) &&
+        (memcmp(&str[8], co_http_month_names[month], 3) != 0))
+    {
+        ++month;
+    }
+
+    int day;
+    int year;
+    int hour;
+    int minute;
+    int second;
+
+    if ((month == 12) ||
+        !co_http_parse_date_number(&str[5], 2, &day) ||
+        !co_http_parse_date_number(&str[12], 4, &year) ||
+        !co_http_parse_date_number(&str[17], 2, &hour) ||
+        !co_http_parse_date_number(&str[20], 2, &minute) ||
+        !co_http_parse_date_number(&str[23], 2, &second) ||
+        (day < 1) || (day > 31) || (hour > 23) ||
+        (minute > 59) || (second > 60))
+    {
+        return false;
+    }
+
+    // days from the civil date, without timegm which windows lacks
+
+    const int y = (month < 2) ? (year - 1) : year;
+    const int m = (month < 2) ? (month + 13) : (month + 1);
+
+    const int64_t days =
+        (int64_t)365 * y + (y / 4) - (y / 100) + (y / 400) +
+        ((153 * (m - 3) + 2) / 5) + day - 719469;
+
+    *unix_time =
+        (days * 86400) + (hour * 3600) + (minute * 60) + second;
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+const char*
+co_http_get_current_date(
+    void
+)
+{
+    const time_t now = time(NULL);
+
+    if (now != co_http_date_time)
+    {
+        co_http_format_date((int64_t)now, co_http_date);
+
+        co_http_date_time = now;
+    }
+
+    return co_http_date;
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
@@ -6,6 +6,7 @@
 #include <coldforce/tls/co_tls_tcp_client.h>
 
 #include <coldforce/http/co_http_client.h>
+#include <coldforce/http/co_http_server.h>
 #include <coldforce/http/co_http_config.h>
 #include <coldforce/http/co_http_log.h>
 
@@ -67,6 +68,10 @@ co_http_client_setup(
         client->conn.tcp_client,
         co_http_config_get_max_receive_wait_time());
 
+    co_tcp_set_max_receive_all_size(
+        client->conn.tcp_client,
+        co_http_config_get_max_receive_read_size());
+
     client->callbacks.on_close = NULL;
     client->callbacks.on_connect = NULL;
     client->callbacks.on_receive_start = NULL;
@@ -79,6 +84,10 @@ co_http_client_setup(
 
     client->request = NULL;
     client->response = NULL;
+
+    client->file_sender = NULL;
+
+    client->response_queue = NULL;
 }
 
 void
@@ -100,6 +109,18 @@ co_http_client_cleanup(
 
         co_http_response_destroy(client->response);
         client->response = NULL;
+
+        if ((client->file_sender != NULL) &&
+            (client->conn.tcp_client != NULL))
+        {
+            client->conn.tcp_client->callbacks.on_send_buffer_low = NULL;
+        }
+
+        co_http_file_sender_destroy(client->file_sender);
+        client->file_sender = NULL;
+
+        co_list_destroy(client->response_queue);
+        client->response_queue = NULL;
     }
 }
 
@@ -203,21 +224,44 @@ co_http_client_on_tcp_receive_ready(
     co_http_client_t* client =
         (co_http_client_t*)tcp_client->sock.sub_class;
 
-    ssize_t receive_result =
-        client->conn.module.receive_all(
-            client->conn.tcp_client,
-            client->conn.receive_data.ptr);
+    if ((client->response != NULL) &&
+        !co_http_header_materialize(&client->response->message.header))
+    {
+        co_http_client_on_resopnse(
+            thread, client, CO_HTTP_ERROR_OUT_OF_MEMORY);
 
-    co_tcp_restart_timer(client->conn.tcp_client);
+        return;
+    }
+
+    ssize_t receive_result = 0;
 
-    if (receive_result <= 0)
+    // a paused body can leave a whole read unconsumed, it is handled
+    // before reading more so that the buffer stays bounded
+    if ((client->response != NULL) &&
+        co_http_message_is_header_complete(&client->response->message) &&
+        ((co_byte_array_get_count(client->conn.receive_data.ptr) -
+            client->conn.receive_data.index) >=
+                co_http_config_get_max_receive_read_size()))
     {
-        return;
+        co_tcp_client_continue_receive(client->conn.tcp_client);
     }
+    else
+    {
+        receive_result = co_http_connection_receive(&client->conn);
+    }
+
+    co_tcp_restart_timer(client->conn.tcp_client);
 
     size_t data_size =
         co_byte_array_get_count(client->conn.receive_data.ptr);
 
+    // data left over by a pause is handled even without a new read
+    if ((receive_result <= 0) &&
+        (data_size <= client->conn.receive_data.index))
+    {
+        return;
+    }
+
     while (data_size > client->conn.receive_data.index)
     {
         if (co_list_get_count(client->request_queue) == 0)
@@ -225,6 +269,11 @@ co_http_client_on_tcp_receive_ready(
             break;
         }
 
+        if (co_tcp_is_receive_paused(tcp_client))
+        {
+            return;
+        }
+
         if (client->response == NULL)
         {
             co_list_data_st* data =
@@ -240,6 +289,14 @@ co_http_client_on_tcp_receive_ready(
                 return;
             }
 
+            // fields stay in the receive buffer while the response is
+            // handled, they are copied only if it outlives this read
+            client->response->message.parser.zero_copy = true;
+        }
+
+        if (!co_http_message_is_header_complete(&client->response->message))
+        {
+            // keeps the partial response, parsing resumes on the next read
             int result = co_http_response_deserialize(
                 client->response, client->conn.receive_data.ptr,
                 &client->conn.receive_data.index);
@@ -265,6 +322,7 @@ co_http_client_on_tcp_receive_ready(
                 }
 
                 if ((!client->content_receiver.chunked) &&
+                    (client->callbacks.on_receive_data == NULL) &&
                     (client->content_receiver.size >
                         co_http_config_get_max_receive_content_size()))
                 {
@@ -276,9 +334,6 @@ co_http_client_on_tcp_receive_ready(
             }
             else if (result == CO_HTTP_PARSE_MORE_DATA)
             {
-                co_http_response_destroy(client->response);
-                client->response = NULL;
-
                 return;
             }
             else
@@ -333,8 +388,7 @@ co_http_client_on_tcp_receive_ready(
 
     if (co_list_get_count(client->request_queue) == 0)
     {
-        client->conn.receive_data.index = 0;
-        co_byte_array_clear(client->conn.receive_data.ptr);
+        co_http_connection_clear_receive_data(&client->conn);
     }
 }
 
@@ -490,6 +544,11 @@ co_http_send_data(
         &client->conn.tcp_client->sock.remote.net_addr,
         "http send data %zd bytes", data_size);
 
+    if (co_http_server_is_holding_response(client))
+    {
+        return co_http_server_add_held_data(client, data, data_size);
+    }
+
     return co_http_connection_send_data(
         &client->conn, data, data_size);
 }
@@ -503,6 +562,41 @@ co_http_is_running(
         co_list_get_count(client->request_queue) > 0);
 }
 
+void
+co_http_pause_receive(
+    co_http_client_t* client
+)
+{
+    if (!co_http_connection_is_server(&client->conn))
+    {
+        co_tcp_stop_timer(client->conn.tcp_client);
+    }
+
+    co_tcp_pause_receive(client->conn.tcp_client);
+}
+
+void
+co_http_resume_receive(
+    co_http_client_t* client
+)
+{
+    if (!co_http_connection_is_server(&client->conn) &&
+        (co_list_get_count(client->request_queue) > 0))
+    {
+        co_tcp_start_timer(client->conn.tcp_client);
+    }
+
+    co_tcp_resume_receive(client->conn.tcp_client);
+}
+
+bool
+co_http_is_receive_paused(
+    const co_http_client_t* client
+)
+{
+    return co_tcp_is_receive_paused(client->conn.tcp_client);
+}
+
 co_socket_t*
 co_http_get_socket(
     co_http_client_t* client
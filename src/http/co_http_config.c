@@ -18,7 +18,10 @@ static co_http_config_t http_config =
     CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_HEADER_LINE_SIZE,
     CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_HEADER_FIELD_COUNT,
     CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_CONTENT_SIZE,
-    CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_WAIT_TIME
+    CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_WAIT_TIME,
+    CO_HTTP_CONFIG_DEFAULT_MAX_RECEIVE_READ_SIZE,
+    CO_HTTP_CONFIG_DEFAULT_RECEIVE_BUFFER_SIZE,
+    CO_HTTP_CONFIG_DEFAULT_MAX_DEFERRED_RESPONSE_COUNT
 };
 
 //---------------------------------------------------------------------------//
@@ -88,3 +91,51 @@ co_http_config_get_max_receive_wait_time(
 {
     return http_config.max_receive_wait_time;
 }
+
+void
+co_http_config_set_max_receive_read_size(
+    size_t max_receive_read_size
+)
+{
+    http_config.max_receive_read_size = max_receive_read_size;
+}
+
+size_t
+co_http_config_get_max_receive_read_size(
+    void
+)
+{
+    return http_config.max_receive_read_size;
+}
+
+void
+co_http_config_set_receive_buffer_size(
+    size_t receive_buffer_size
+)
+{
+    http_config.receive_buffer_size = receive_buffer_size;
+}
+
+size_t
+co_http_config_get_receive_buffer_size(
+    void
+)
+{
+    return http_config.receive_buffer_size;
+}
+
+void
+co_http_config_set_max_deferred_response_count(
+    size_t max_deferred_response_count
+)
+{
+    http_config.max_deferred_response_count = max_deferred_response_count;
+}
+
+size_t
+co_http_config_get_max_deferred_response_count(
+    void
+)
+{
+    return http_config.max_deferred_response_count;
+}
@@ -4,6 +4,7 @@
 #include <coldforce/tls/co_tls_tcp_client.h>
 
 #include <coldforce/http/co_http_client.h>
+#include <coldforce/http/co_http_config.h>
 #include <coldforce/http/co_http_log.h>
 
 //---------------------------------------------------------------------------//
@@ -114,6 +115,7 @@ co_http_connection_setup(
         conn->module.close = co_tcp_close;
         conn->module.connect = co_tcp_connect_start;
         conn->module.send = co_tls_tcp_send;
+        conn->module.send_vec = co_tls_tcp_send_vec;
         conn->module.receive_all = co_tls_tcp_receive_all;
 
         conn->tcp_client =
@@ -137,6 +139,7 @@ co_http_connection_setup(
         conn->module.close = co_tcp_close;
         conn->module.connect = co_tcp_connect_start;
         conn->module.send = co_tcp_send;
+        conn->module.send_vec = co_tcp_send_vec;
         conn->module.receive_all = co_tcp_receive_all;
 
         conn->tcp_client =
@@ -227,6 +230,35 @@ co_http_connection_is_server(
     return (conn->url_origin == NULL);
 }
 
+ssize_t
+co_http_connection_receive(
+    co_http_connection_t* conn
+)
+{
+    if (conn->receive_data.index > 0)
+    {
+        co_byte_array_remove(
+            conn->receive_data.ptr, 0, conn->receive_data.index);
+
+        conn->receive_data.index = 0;
+    }
+
+    return conn->module.receive_all(
+        conn->tcp_client, conn->receive_data.ptr);
+}
+
+void
+co_http_connection_clear_receive_data(
+    co_http_connection_t* conn
+)
+{
+    conn->receive_data.index = 0;
+
+    co_byte_array_clear(conn->receive_data.ptr);
+    co_byte_array_shrink(
+        conn->receive_data.ptr, co_http_config_get_receive_buffer_size());
+}
+
 //---------------------------------------------------------------------------//
 // public
 //---------------------------------------------------------------------------//
@@ -244,12 +276,24 @@ co_http_connection_send_request(
 
     co_byte_array_t* buffer = co_byte_array_create();
 
-    co_http_request_serialize(request, buffer);
+    co_http_request_serialize_header(request, buffer);
+
+    co_buffer_st buffers[2];
+    size_t buffer_count = 0;
+
+    buffers[buffer_count].ptr = co_byte_array_get_ptr(buffer, 0);
+    buffers[buffer_count].size = co_byte_array_get_count(buffer);
+    ++buffer_count;
+
+    if ((request->message.data.ptr != NULL) &&
+        (request->message.data.size > 0))
+    {
+        buffers[buffer_count] = request->message.data;
+        ++buffer_count;
+    }
 
     bool result =
-        co_http_connection_send_data(conn,
-            co_byte_array_get_ptr(buffer, 0),
-            co_byte_array_get_count(buffer));
+        co_http_connection_send_vec(conn, buffers, buffer_count);
 
     co_byte_array_destroy(buffer);
 
@@ -277,18 +321,70 @@ co_http_connection_send_response(
 
     co_byte_array_t* buffer = co_byte_array_create();
 
-    co_http_response_serialize(response, buffer);
+    co_http_response_serialize_header(response, buffer);
+
+    co_buffer_st buffers[2];
+    size_t buffer_count = 0;
+
+    buffers[buffer_count].ptr = co_byte_array_get_ptr(buffer, 0);
+    buffers[buffer_count].size = co_byte_array_get_count(buffer);
+    ++buffer_count;
+
+    if ((response->message.data.ptr != NULL) &&
+        (response->message.data.size > 0))
+    {
+        buffers[buffer_count] = response->message.data;
+        ++buffer_count;
+    }
 
     bool result =
-        co_http_connection_send_data(conn,
-            co_byte_array_get_ptr(buffer, 0),
-            co_byte_array_get_count(buffer));
+        co_http_connection_send_vec(conn, buffers, buffer_count);
 
     co_byte_array_destroy(buffer);
 
     return result;
 }
 
+bool
+co_http_connection_send_response_template(
+    co_http_connection_t* conn,
+    const co_http_response_template_t* response_template,
+    const void* data,
+    size_t data_size
+)
+{
+    co_http_log_debug(
+        &conn->tcp_client->sock.local.net_addr, "-->",
+        &conn->tcp_client->sock.remote.net_addr,
+        "http send response template (%zd bytes)", data_size);
+
+    char tail[CO_HTTP_RESPONSE_TEMPLATE_TAIL_SIZE];
+
+    co_buffer_st buffers[3];
+    size_t buffer_count = 0;
+
+    buffers[buffer_count].ptr =
+        co_byte_array_get_ptr(response_template->header_block, 0);
+    buffers[buffer_count].size =
+        co_byte_array_get_count(response_template->header_block);
+    ++buffer_count;
+
+    buffers[buffer_count].ptr = tail;
+    buffers[buffer_count].size =
+        co_http_response_template_serialize_tail(
+            response_template, data_size, tail);
+    ++buffer_count;
+
+    if ((data != NULL) && (data_size > 0))
+    {
+        buffers[buffer_count].ptr = (void*)data;
+        buffers[buffer_count].size = data_size;
+        ++buffer_count;
+    }
+
+    return co_http_connection_send_vec(conn, buffers, buffer_count);
+}
+
 bool
 co_http_connection_send_data(
     co_http_connection_t* conn,
@@ -299,3 +395,14 @@ co_http_connection_send_data(
     return conn->module.send(
         conn->tcp_client, data, data_size);
 }
+
+bool
+co_http_connection_send_vec(
+    co_http_connection_t* conn,
+    const co_buffer_st* buffers,
+    size_t buffer_count
+)
+{
+    return conn->module.send_vec(
+        conn->tcp_client, buffers, buffer_count);
+}
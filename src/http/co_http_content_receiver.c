@@ -3,8 +3,10 @@
 #include <coldforce/core/co_string_token.h>
 
 #include <coldforce/http/co_http_content_receiver.h>
+#include <coldforce/http/co_http_client.h>
 #include <coldforce/http/co_http_config.h>
 #include <coldforce/http/co_http_log.h>
+#include <coldforce/http/co_http_scan.h>
 
 //---------------------------------------------------------------------------//
 // http content receiver
@@ -85,15 +87,17 @@ co_http_receive_chunked_data(
 
     size_t receive_size = data_size - receiver->index;
 
+    // the limit bounds the buffered content, streamed data is not kept
     const size_t max_content_size =
-        co_http_config_get_max_receive_content_size();
+        (client->callbacks.on_receive_data == NULL) ?
+            co_http_config_get_max_receive_content_size() : SIZE_MAX;
 
     while (receive_size > 0)
     {
         if (receiver->chunk_size == 0)
         {
-            const char* new_line = co_string_find_n(
-                &data_ptr[receiver->index], CO_HTTP_CRLF, receive_size);
+            const char* new_line = co_http_scan_crlf(
+                &data_ptr[receiver->index], receive_size);
 
             if (new_line == NULL)
             {
@@ -177,6 +181,12 @@ co_http_receive_chunked_data(
             receiver->index += content_size;
 
             receive_size = data_size - receiver->index;
+
+            if (co_tcp_is_receive_paused(client->conn.tcp_client))
+            {
+                // the rest stays in the receive buffer until resumed
+                return CO_HTTP_PARSE_MORE_DATA;
+            }
         }
 
         if (receiver->chunk_size == 0)
@@ -248,8 +258,8 @@ co_http_start_receive_content(
     size_t index
 )
 {
-    const char* value = co_http_header_get_field(
-        &message->header, CO_HTTP_HEADER_TRANSFER_ENCODING);
+    const char* value = co_http_header_get_field_by_id(
+        &message->header, CO_HTTP_HEADER_ID_TRANSFER_ENCODING);
 
     if (value != NULL)
     {
@@ -293,6 +303,9 @@ co_http_receive_content_data(
     co_byte_array_t* receive_data
 )
 {
+    // the consumed part of the receive buffer is dropped between reads
+    receiver->index = client->conn.receive_data.index;
+
     if (receiver->chunked)
     {
         return co_http_receive_chunked_data(receiver, client, receive_data);
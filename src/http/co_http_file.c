@@ -0,0 +1,386 @@
+#include <coldforce/core/co_std.h>
+#include <coldforce/core/co_string.h>
+
+#include <coldforce/http/co_http_file.h>
+#include <coldforce/http/co_http_scan.h>
+
+#include <inttypes.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef CO_OS_WIN
+#   include <io.h>
+#   define co_http_file_open_fd(path) \
+        _open((path), _O_RDONLY | _O_BINARY)
+#   define co_http_file_close_fd        _close
+#   define co_http_file_stat_st         struct _stat64
+#   define co_http_file_fstat           _fstat64
+#   define co_http_file_is_regular(mode) (((mode) & _S_IFMT) == _S_IFREG)
+#else
+#   include <unistd.h>
+#   define co_http_file_open_fd(path) \
+        open((path), O_RDONLY | O_CLOEXEC)
+#   define co_http_file_close_fd        close
+#   define co_http_file_stat_st         struct stat
+#   define co_http_file_fstat           fstat
+#   define co_http_file_is_regular(mode) S_ISREG(mode)
+#endif
+
+//---------------------------------------------------------------------------//
+// http file
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+bool
+co_http_file_open(
+    const char* path,
+    co_http_file_st* file
+)
+{
+    file->fd = co_http_file_open_fd(path);
+
+    if (file->fd == -1)
+    {
+        return false;
+    }
+
+    co_http_file_stat_st st;
+
+    if ((co_http_file_fstat(file->fd, &st) != 0) ||
+        !co_http_file_is_regular(st.st_mode) ||
+        ((uint64_t)st.st_size > SIZE_MAX))
+    {
+        co_http_file_close_fd(file->fd);
+        file->fd = -1;
+
+        return false;
+    }
+
+    file->size = (uint64_t)st.st_size;
+    file->modified_time = (int64_t)st.st_mtime;
+
+    // weak, the modified time has a resolution of a second
+    snprintf(file->etag, sizeof(file->etag),
+        "W/\"%" PRIx64 "-%" PRIx64 "\"",
+        file->size, (uint64_t)file->modified_time);
+
+    return true;
+}
+
+void
+co_http_file_close(
+    co_http_file_st* file
+)
+{
+    if (file->fd != -1)
+    {
+        co_http_file_close_fd(file->fd);
+        file->fd = -1;
+    }
+}
+
+ssize_t
+co_http_file_read(
+    const co_http_file_st* file,
+    uint64_t offset,
+    void* buffer,
+    size_t size
+)
+{
+    // read() rather than a mapping, a file truncated meanwhile
+    // must not fault the thread
+#ifdef CO_OS_WIN
+    if (_lseeki64(file->fd, (__int64)offset, SEEK_SET) == -1)
+    {
+        return -1;
+    }
+
+    return (ssize_t)_read(file->fd, buffer, (unsigned int)size);
+#else
+    return pread(file->fd, buffer, size, (off_t)offset);
+#endif
+}
+
+static bool
+co_http_file_match_etag(
+    const co_http_file_st* file,
+    const char* if_none_match
+)
+{
+    // weak comparison: the opaque tags are compared without W/
+
+    const char* etag = &file->etag[2];
+    const size_t etag_length = strlen(etag);
+
+    const size_t length = strlen(if_none_match);
+    size_t begin = 0;
+
+    while (begin < length)
+    {
+        const char* comma = co_http_scan_char(
+            &if_none_match[begin], length - begin, ',');
+
+        size_t end = (comma != NULL) ?
+            (size_t)(comma - if_none_match) : length;
+        size_t next = end + 1;
+
+        co_http_scan_trim_ows(if_none_match, &begin, &end);
+
+        if (((end - begin) == 1) && (if_none_match[begin] == '*'))
+        {
+            return true;
+        }
+
+        if (((end - begin) > 2) &&
+            (if_none_match[begin] == 'W') &&
+            (if_none_match[begin + 1] == '/'))
+        {
+            begin += 2;
+        }
+
+        if (((end - begin) == etag_length) &&
+            (memcmp(&if_none_match[begin], etag, etag_length) == 0))
+        {
+            return true;
+        }
+
+        begin = next;
+    }
+
+    return false;
+}
+
+bool
+co_http_file_is_not_modified(
+    const co_http_file_st* file,
+    const co_http_request_t* request
+)
+{
+    const co_http_header_t* header =
+        co_http_request_get_const_header(request);
+
+    const char* if_none_match =
+        co_http_header_get_field(header, CO_HTTP_HEADER_IF_NONE_MATCH);
+
+    if (if_none_match != NULL)
+    {
+        // If-Modified-Since is ignored when If-None-Match is present
+        return co_http_file_match_etag(file, if_none_match);
+    }
+
+    const char* if_modified_since =
+        co_http_header_get_field(header, CO_HTTP_HEADER_IF_MODIFIED_SINCE);
+
+    int64_t since_time;
+
+    if ((if_modified_since == NULL) ||
+        !co_http_parse_date(if_modified_since, &since_time))
+    {
+        return false;
+    }
+
+    return (file->modified_time <= since_time);
+}
+
+static bool
+co_http_file_parse_position(
+    const char* str,
+    size_t length,
+    uint64_t* value
+)
+{
+    if ((length == 0) || (length > 19))
+    {
+        return false;
+    }
+
+    *value = 0;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        if ((str[index] < '0') || (str[index] > '9'))
+        {
+            return false;
+        }
+
+        *value = (*value * 10) + (uint64_t)(str[index] - '0');
+    }
+
+    return true;
+}
+
+int
+co_http_file_get_range(
+    const co_http_file_st* file,
+    const co_http_request_t* request,
+    uint64_t* offset,
+    uint64_t* size
+)
+{
+    static const char unit[] = "bytes=";
+
+    const co_http_header_t* header =
+        co_http_request_get_const_header(request);
+
+    const char* range =
+        co_http_header_get_field(header, CO_HTTP_HEADER_RANGE);
+
+    if ((range == NULL) ||
+        (co_string_case_compare_n(range, unit, sizeof(unit) - 1) != 0))
+    {
+        return CO_HTTP_FILE_RANGE_NONE;
+    }
+
+    const char* if_range =
+        co_http_header_get_field(header, CO_HTTP_HEADER_IF_RANGE);
+
+    if (if_range != NULL)
+    {
+        // the weak etag never matches, a date must be the exact
+        // modified time
+
+        int64_t if_range_time;
+
+        if (!co_http_parse_date(if_range, &if_range_time) ||
+            (if_range_time != file->modified_time))
+        {
+            return CO_HTTP_FILE_RANGE_NONE;
+        }
+    }
+
+    const char* spec = &range[sizeof(unit) - 1];
+    size_t begin = 0;
+    size_t end = strlen(spec);
+
+    co_http_scan_trim_ows(spec, &begin, &end);
+
+    const char* hyphen =
+        co_http_scan_char(&spec[begin], end - begin, '-');
+
+    if ((hyphen == NULL) ||
+        (co_http_scan_char(&spec[begin], end - begin, ',') != NULL))
+    {
+        return CO_HTTP_FILE_RANGE_NONE;
+    }
+
+    const size_t hyphen_index = (size_t)(hyphen - spec);
+
+    uint64_t first = 0;
+    uint64_t last = 0;
+
+    const bool has_first = co_http_file_parse_position(
+        &spec[begin], hyphen_index - begin, &first);
+    const bool has_last = co_http_file_parse_position(
+        &spec[hyphen_index + 1], end - hyphen_index - 1, &last);
+
+    if (has_first)
+    {
+        if ((hyphen_index + 1) < end)
+        {
+            if (!has_last || (last < first))
+            {
+                return CO_HTTP_FILE_RANGE_NONE;
+            }
+        }
+        else
+        {
+            last = UINT64_MAX;
+        }
+
+        if (first >= file->size)
+        {
+            return CO_HTTP_FILE_RANGE_UNSATISFIABLE;
+        }
+
+        if (last >= file->size)
+        {
+            last = file->size - 1;
+        }
+
+        *offset = first;
+        *size = last - first + 1;
+    }
+    else
+    {
+        // suffix range, the last n bytes
+
+        if ((hyphen_index != begin) || !has_last)
+        {
+            return CO_HTTP_FILE_RANGE_NONE;
+        }
+
+        if ((last == 0) || (file->size == 0))
+        {
+            return CO_HTTP_FILE_RANGE_UNSATISFIABLE;
+        }
+
+        if (last > file->size)
+        {
+            last = file->size;
+        }
+
+        *offset = file->size - last;
+        *size = last;
+    }
+
+    return CO_HTTP_FILE_RANGE_SATISFIABLE;
+}
+
+co_http_file_sender_t*
+co_http_file_sender_create(
+    co_http_file_st* file,
+    uint64_t offset,
+    uint64_t size
+)
+{
+    co_http_file_sender_t* sender =
+        (co_http_file_sender_t*)co_mem_alloc(
+            sizeof(co_http_file_sender_t));
+
+    if (sender == NULL)
+    {
+        return NULL;
+    }
+
+    sender->buffer = (uint8_t*)co_mem_alloc(CO_HTTP_FILE_READ_BLOCK_SIZE);
+
+    if (sender->buffer == NULL)
+    {
+        co_mem_free(sender);
+
+        return NULL;
+    }
+
+    // takes the file over
+    sender->file = *file;
+    file->fd = -1;
+
+    sender->offset = offset;
+    sender->remaining_size = size;
+
+    return sender;
+}
+
+void
+co_http_file_sender_destroy(
+    co_http_file_sender_t* sender
+)
+{
+    if (sender != NULL)
+    {
+        co_http_file_close(&sender->file);
+
+        co_mem_free(sender->buffer);
+        co_mem_free(sender);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
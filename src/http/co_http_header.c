@@ -1,9 +1,11 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_string.h>
 #include <coldforce/core/co_string_token.h>
+#include <coldforce/core/co_mem_pool.h>
 
 #include <coldforce/http/co_http_header.h>
 #include <coldforce/http/co_http_config.h>
+#include <coldforce/http/co_http_scan.h>
 
 #ifndef CO_OS_WIN
 #include <errno.h>
@@ -16,18 +18,256 @@
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+#define CO_HTTP_HEADER_MIN_SLOT_COUNT   16
+
+typedef struct
+{
+    const char* name;
+
+    // co_http_header_hash of the name
+    uint32_t hash;
+
+} co_http_header_known_field_st;
+
+static const co_http_header_known_field_st
+    co_http_header_known_fields[CO_HTTP_HEADER_ID_COUNT] =
+{
+    { CO_HTTP_HEADER_CONTENT_LENGTH, 0x4df9451d },
+    { CO_HTTP_HEADER_HOST, 0xaffea56f },
+    { CO_HTTP_HEADER_TRANSFER_ENCODING, 0xddb4744c },
+    { CO_HTTP_HEADER_SET_COOKIE, 0x6e2be738 },
+    { CO_HTTP_HEADER_COOKIE, 0x77a740bf },
+    { CO_HTTP_HEADER_CONNECTION, 0x38b99ed9 },
+    { CO_HTTP_HEADER_UPGRADE, 0xdc97cc77 },
+    { CO_HTTP_HEADER_AUTHORIZATION, 0x913657be },
+    { CO_HTTP_HEADER_WWW_AUTHENTICATE, 0x2e7bcf02 },
+    { CO_HTTP_HEADER_DATE, 0xd472dc59 }
+};
+
 //---------------------------------------------------------------------------//
 // private
 //---------------------------------------------------------------------------//
 
+// FNV-1a over the lowercased name
+static uint32_t
+co_http_header_hash(
+    const char* name
+)
+{
+    uint32_t hash = 0x811c9dc5;
+
+    for (; (*name) != '\0'; ++name)
+    {
+        uint8_t ch = (uint8_t)(*name);
+
+        if ((ch >= 'A') && (ch <= 'Z'))
+        {
+            ch += ('a' - 'A');
+        }
+
+        hash = (hash ^ ch) * 0x01000193;
+    }
+
+    return hash;
+}
+
+static co_http_header_slot_st*
+co_http_header_find_slot(
+    const co_http_header_t* header,
+    const char* name,
+    uint32_t hash
+)
+{
+    if (header->slots == NULL)
+    {
+        return NULL;
+    }
+
+    const size_t mask = header->slot_count - 1;
+    size_t index = hash & mask;
+
+    // the table is never full, so the probe ends at an empty slot
+    for (;;)
+    {
+        co_http_header_slot_st* slot = &header->slots[index];
+
+        if (slot->it == NULL)
+        {
+            return slot;
+        }
+
+        if (slot->hash == hash)
+        {
+            const co_http_header_field_t* field =
+                (const co_http_header_field_t*)slot->it->data.value;
+
+            if (co_string_case_compare(field->name, name) == 0)
+            {
+                return slot;
+            }
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+static co_list_iterator_t*
+co_http_header_find(
+    const co_http_header_t* header,
+    const char* name,
+    uint32_t hash
+)
+{
+    const co_http_header_slot_st* slot =
+        co_http_header_find_slot(header, name, hash);
+
+    return (slot != NULL) ? slot->it : NULL;
+}
+
+static bool
+co_http_header_resize_index(
+    co_http_header_t* header,
+    size_t slot_count
+)
+{
+    co_http_header_slot_st* slots =
+        (co_http_header_slot_st*)co_mem_pool_alloc(
+            sizeof(co_http_header_slot_st) * slot_count);
+
+    if (slots == NULL)
+    {
+        return false;
+    }
+
+    memset(slots, 0x00, sizeof(co_http_header_slot_st) * slot_count);
+
+    co_http_header_slot_st* old_slots = header->slots;
+    const size_t old_slot_count = header->slot_count;
+
+    header->slots = slots;
+    header->slot_count = slot_count;
+
+    for (size_t old_index = 0; old_index < old_slot_count; ++old_index)
+    {
+        const co_http_header_slot_st* old_slot = &old_slots[old_index];
+
+        if (old_slot->it != NULL)
+        {
+            size_t index = old_slot->hash & (slot_count - 1);
+
+            while (slots[index].it != NULL)
+            {
+                index = (index + 1) & (slot_count - 1);
+            }
+
+            slots[index] = *old_slot;
+        }
+    }
+
+    co_mem_pool_free(old_slots);
+
+    return true;
+}
+
+static bool
+co_http_header_index_field(
+    co_http_header_t* header,
+    co_list_iterator_t* it
+)
+{
+    const co_http_header_field_t* field =
+        (const co_http_header_field_t*)it->data.value;
+
+    // keep the load factor at or below 1/2
+    if ((header->used_count + 1) * 2 > header->slot_count)
+    {
+        const size_t slot_count = (header->slot_count > 0) ?
+            (header->slot_count * 2) : CO_HTTP_HEADER_MIN_SLOT_COUNT;
+
+        if (!co_http_header_resize_index(header, slot_count))
+        {
+            return false;
+        }
+    }
+
+    co_http_header_slot_st* slot =
+        co_http_header_find_slot(header, field->name, field->hash);
+
+    // a later field of the same name stays behind the first one
+    if (slot->it == NULL)
+    {
+        slot->hash = field->hash;
+        slot->it = it;
+
+        ++header->used_count;
+    }
+
+    return true;
+}
+
+static void
+co_http_header_rebuild_index(
+    co_http_header_t* header
+)
+{
+    if (header->slots != NULL)
+    {
+        memset(header->slots, 0x00,
+            sizeof(co_http_header_slot_st) * header->slot_count);
+    }
+
+    header->used_count = 0;
+
+    co_list_iterator_t* it =
+        co_list_get_head_iterator(header->field_list);
+
+    while (it != NULL)
+    {
+        co_http_header_index_field(header, it);
+
+        it = co_list_get_next_iterator(header->field_list, it);
+    }
+}
+
+static co_http_header_field_t*
+co_http_header_field_create(
+    char* name,
+    char* value,
+    bool view
+)
+{
+    co_http_header_field_t* field =
+        (co_http_header_field_t*)co_mem_pool_alloc(
+            sizeof(co_http_header_field_t));
+
+    if (field == NULL)
+    {
+        return NULL;
+    }
+
+    field->name = name;
+    field->value = value;
+    field->view = view;
+    field->hash = co_http_header_hash(name);
+
+    return field;
+}
+
 static void
 co_http_header_field_destroy(
     co_http_header_field_t* field
 )
 {
-    co_string_destroy(field->name);
-    co_string_destroy(field->value);
-    co_mem_free(field);
+    if (field != NULL)
+    {
+        if (!field->view)
+        {
+            co_string_destroy(field->name);
+            co_string_destroy(field->value);
+        }
+
+        co_mem_pool_free(field);
+    }
 }
 
 static int
@@ -39,6 +279,32 @@ co_http_header_field_compare(
     return co_string_case_compare(field1->name, field2->name);
 }
 
+static bool
+co_http_header_add_field_struct(
+    co_http_header_t* header,
+    co_http_header_field_t* field
+)
+{
+    if (!co_list_add_tail(header->field_list, field))
+    {
+        return false;
+    }
+
+    co_list_iterator_t* it =
+        co_list_get_tail_iterator(header->field_list);
+
+    if (!co_http_header_index_field(header, it))
+    {
+        // the caller still owns the field
+        it->data.value = NULL;
+        co_list_remove_at(header->field_list, it);
+
+        return false;
+    }
+
+    return true;
+}
+
 bool
 co_http_header_add_field_ptr(
     co_http_header_t* header,
@@ -47,18 +313,21 @@ co_http_header_add_field_ptr(
 )
 {
     co_http_header_field_t* field =
-        (co_http_header_field_t*)co_mem_alloc(
-            sizeof(co_http_header_field_t));
+        co_http_header_field_create(name, value, false);
 
     if (field == NULL)
     {
         return false;
     }
 
-    field->name = name;
-    field->value = value;
+    if (!co_http_header_add_field_struct(header, field))
+    {
+        co_mem_pool_free(field);
 
-    return co_list_add_tail(header->field_list, field);
+        return false;
+    }
+
+    return true;
 }
 
 void
@@ -86,128 +355,126 @@ co_http_header_serialize(
 }
 
 int
-co_http_header_deserialize(
+co_http_header_deserialize_field(
     co_http_header_t* header,
-    const co_byte_array_t* data,
-    size_t* index
+    const char* line,
+    size_t line_length,
+    bool zero_copy
 )
 {
-    const char* data_ptr =
-        (const char*)co_byte_array_get_const_ptr(data, 0);
-    const size_t data_size = co_byte_array_get_count(data);
+    const char* colon =
+        co_http_scan_char(line, line_length, ':');
 
-    const size_t max_header_line_size =
-        co_http_config_get_max_receive_header_line_size();
-    const size_t max_header_field_count =
-        co_http_config_get_max_receive_header_field_count();
+    if (colon == NULL)
+    {
+        return CO_HTTP_PARSE_ERROR;
+    }
 
-    for (;;)
+    size_t name_begin = 0;
+    size_t name_end = colon - line;
+    size_t value_begin = name_end + CO_HTTP_COLON_LENGTH;
+    size_t value_end = line_length;
+
+    co_http_scan_trim_ows(line, &name_begin, &name_end);
+    co_http_scan_trim_ows(line, &value_begin, &value_end);
+
+    // the field name must be a non-empty token
+    if ((name_begin == name_end) ||
+        (co_http_scan_token(&line[name_begin], name_end - name_begin) !=
+            (name_end - name_begin)))
     {
-        if (co_http_header_get_field_count(header) >
-            max_header_field_count)
-        {
-            return CO_HTTP_ERROR_HEADER_FIELDS_TOO_MANY;
-        }
+        return CO_HTTP_PARSE_ERROR;
+    }
 
-        const char* temp_data = &data_ptr[(*index)];
-        size_t temp_size = data_size - (*index);
+    if (zero_copy)
+    {
+        // the line has been consumed from the receive buffer,
+        // terminate name and value in place and point at them
+        char* view = (char*)line;
 
-        const char* new_line =
-            co_string_find_n(temp_data, CO_HTTP_CRLF, temp_size);
+        view[name_end] = '\0';
+        view[value_end] = '\0';
 
-        if (new_line == NULL)
+        co_http_header_field_t* field =
+            co_http_header_field_create(
+                &view[name_begin], &view[value_begin], true);
+
+        if ((field == NULL) ||
+            !co_http_header_add_field_struct(header, field))
         {
-            if (temp_size > max_header_line_size)
-            {
-                return CO_HTTP_ERROR_HEADER_LINE_TOO_LONG;
-            }
-            else
-            {
-                return CO_HTTP_PARSE_MORE_DATA;
-            }
+            co_http_header_field_destroy(field);
+
+            return CO_HTTP_PARSE_ERROR;
         }
 
-        if (new_line == temp_data)
-        {
-            (*index) += CO_HTTP_CRLF_LENGTH;
+        return CO_HTTP_PARSE_COMPLETE;
+    }
 
-            const char* value =
-                co_http_header_get_field(header, CO_HTTP_HEADER_CONTENT_LENGTH);
-            
-            if (value != NULL)
-            {
-                size_t length = strlen(value);
-
-                while ((*value) != '\0')
-                {
-                    if (((*value) < '0') || ((*value) > '9'))
-                    {
-                        return CO_HTTP_PARSE_ERROR;
-                    }
-
-                    ++value;
-                }
-
-                if (length > CO_SIZE_T_DEC_DIGIT_MAX)
-                {
-                    return CO_HTTP_PARSE_ERROR;
-                }
-                else if (length == CO_SIZE_T_DEC_DIGIT_MAX)
-                {
-                    (void)co_string_to_size_t(value, NULL, 10);
-
-                    if (errno == ERANGE)
-                    {
-                        return CO_HTTP_PARSE_ERROR;
-                    }
-                }
-            }
+    char* name = co_string_duplicate_n(
+        &line[name_begin], name_end - name_begin);
 
-            return CO_HTTP_PARSE_COMPLETE;
-        }
+    if (name == NULL)
+    {
+        return CO_HTTP_PARSE_ERROR;
+    }
 
-        size_t line_length = (new_line - temp_data);
+    char* value = co_string_duplicate_n(
+        &line[value_begin], value_end - value_begin);
 
-        if (line_length > max_header_line_size)
-        {
-            return CO_HTTP_ERROR_HEADER_LINE_TOO_LONG;
-        }
+    if (value == NULL)
+    {
+        co_string_destroy(name);
 
-        const char* colon =
-            co_string_find_n(temp_data, CO_HTTP_COLON, line_length);
+        return CO_HTTP_PARSE_ERROR;
+    }
 
-        if (colon == NULL)
-        {
-            return CO_HTTP_PARSE_MORE_DATA;
-        }
+    if (!co_http_header_add_field_ptr(header, name, value))
+    {
+        co_string_destroy(name);
+        co_string_destroy(value);
 
-        size_t name_size = colon - temp_data;
-        size_t value_size = new_line - colon - CO_HTTP_COLON_LENGTH;
+        return CO_HTTP_PARSE_ERROR;
+    }
 
-        char* name = co_string_duplicate_n(temp_data, name_size);
+    return CO_HTTP_PARSE_COMPLETE;
+}
 
-        if (name == NULL)
-        {
-            return CO_HTTP_PARSE_ERROR;
-        }
+int
+co_http_header_validate_content_length(
+    const co_http_header_t* header
+)
+{
+    const char* value = co_http_header_get_field_by_id(
+        header, CO_HTTP_HEADER_ID_CONTENT_LENGTH);
 
-        char* value = co_string_duplicate_n(
-            temp_data + name_size + CO_HTTP_COLON_LENGTH, value_size);
+    if (value != NULL)
+    {
+        size_t length = strlen(value);
 
-        if (value == NULL)
+        for (const char* digit = value; (*digit) != '\0'; ++digit)
         {
-            co_string_destroy(name);
+            if (((*digit) < '0') || ((*digit) > '9'))
+            {
+                return CO_HTTP_PARSE_ERROR;
+            }
+        }
 
+        if (length > CO_SIZE_T_DEC_DIGIT_MAX)
+        {
             return CO_HTTP_PARSE_ERROR;
         }
+        else if (length == CO_SIZE_T_DEC_DIGIT_MAX)
+        {
+            (void)co_string_to_size_t(value, NULL, 10);
 
-        co_string_trim(name, strlen(name));
-        co_string_trim(value, strlen(value));
-
-        co_http_header_add_field_ptr(header, name, value);
-
-        (*index) += line_length + CO_HTTP_CRLF_LENGTH;
+            if (errno == ERANGE)
+            {
+                return CO_HTTP_PARSE_ERROR;
+            }
+        }
     }
+
+    return CO_HTTP_PARSE_COMPLETE;
 }
 
 void
@@ -222,6 +489,10 @@ co_http_header_setup(
         (co_item_compare_fn)co_http_header_field_compare;
 
     header->field_list = co_list_create(&list_ctx);
+
+    header->slots = NULL;
+    header->slot_count = 0;
+    header->used_count = 0;
 }
 
 void
@@ -233,6 +504,11 @@ co_http_header_cleanup(
     {
         co_list_destroy(header->field_list);
         header->field_list = NULL;
+
+        co_mem_pool_free(header->slots);
+        header->slots = NULL;
+        header->slot_count = 0;
+        header->used_count = 0;
     }
 }
 
@@ -246,6 +522,43 @@ co_http_header_clear(
 )
 {
     co_list_clear(header->field_list);
+    co_http_header_rebuild_index(header);
+}
+
+bool
+co_http_header_materialize(
+    co_http_header_t* header
+)
+{
+    co_list_iterator_t* it =
+        co_list_get_head_iterator(header->field_list);
+
+    while (it != NULL)
+    {
+        co_http_header_field_t* field =
+            (co_http_header_field_t*)co_list_get_next(
+                header->field_list, &it)->value;
+
+        if (field->view)
+        {
+            char* name = co_string_duplicate(field->name);
+            char* value = co_string_duplicate(field->value);
+
+            if ((name == NULL) || (value == NULL))
+            {
+                co_string_destroy(name);
+                co_string_destroy(value);
+
+                return false;
+            }
+
+            field->name = name;
+            field->value = value;
+            field->view = false;
+        }
+    }
+
+    return true;
 }
 
 size_t
@@ -264,9 +577,10 @@ co_http_header_get_value_count(
 {
     size_t value_count = 0;
 
-    co_list_iterator_t* it =
-        co_list_get_head_iterator(header->field_list);
-    
+    // later fields of the same name can only follow the first one
+    co_list_iterator_t* it = co_http_header_find(
+        header, name, co_http_header_hash(name));
+
     while (it != NULL)
     {
         const co_list_data_st* data =
@@ -288,10 +602,8 @@ co_http_header_contains(
     const char* name
 )
 {
-    const co_http_header_field_t find_field = { (char*)name, NULL };
-
-    co_list_iterator_t* it =
-        co_list_find(header->field_list, &find_field);
+    co_list_iterator_t* it = co_http_header_find(
+        header, name, co_http_header_hash(name));
 
     return (it != NULL);
 }
@@ -303,16 +615,21 @@ co_http_header_set_field(
     const char* value
 )
 {
-    const co_http_header_field_t find_field = { (char*)name, NULL };
-
-    co_list_iterator_t* it =
-        co_list_find(header->field_list, &find_field);
+    co_list_iterator_t* it = co_http_header_find(
+        header, name, co_http_header_hash(name));
 
     if (it != NULL)
     {
         co_http_header_field_t* field =
             (co_http_header_field_t*)it->data.value;
 
+        if (field->view)
+        {
+            field->name = co_string_duplicate(field->name);
+            field->value = NULL;
+            field->view = false;
+        }
+
         co_string_destroy(field->value);
         field->value = co_string_duplicate(value);
     }
@@ -328,18 +645,30 @@ co_http_header_get_field(
     const char* name
 )
 {
-    const co_http_header_field_t find_field = { (char*)name, NULL };
-
-    co_list_iterator_t* it =
-        co_list_find(header->field_list, &find_field);
+    co_list_iterator_t* it = co_http_header_find(
+        header, name, co_http_header_hash(name));
 
     if (it != NULL)
     {
-        const co_http_header_field_t* field =
-            (const co_http_header_field_t*)co_list_get(
-                header->field_list, it)->value;
+        return ((const co_http_header_field_t*)it->data.value)->value;
+    }
 
-        return field->value;
+    return NULL;
+}
+
+const char*
+co_http_header_get_field_by_id(
+    const co_http_header_t* header,
+    co_http_header_id_t id
+)
+{
+    co_list_iterator_t* it = co_http_header_find(header,
+        co_http_header_known_fields[id].name,
+        co_http_header_known_fields[id].hash);
+
+    if (it != NULL)
+    {
+        return ((const co_http_header_field_t*)it->data.value)->value;
     }
 
     return NULL;
@@ -355,8 +684,8 @@ co_http_header_get_fields(
 {
     size_t value_count = 0;
 
-    co_list_iterator_t* it =
-        co_list_get_head_iterator(header->field_list);
+    co_list_iterator_t* it = co_http_header_find(
+        header, name, co_http_header_hash(name));
 
     while (it != NULL && (value_count < count))
     {
@@ -383,34 +712,19 @@ co_http_header_add_field(
     const char* value
 )
 {
-    co_http_header_field_t* field =
-        (co_http_header_field_t*)co_mem_alloc(sizeof(co_http_header_field_t));
+    char* name_copy = co_string_duplicate(name);
+    char* value_copy = co_string_duplicate(value);
 
-    if (field == NULL)
+    if ((name_copy == NULL) || (value_copy == NULL) ||
+        !co_http_header_add_field_ptr(header, name_copy, value_copy))
     {
-        return false;
-    }
-
-    field->name = co_string_duplicate(name);
-
-    if (field->name == NULL)
-    {
-        co_mem_free(field);
+        co_string_destroy(name_copy);
+        co_string_destroy(value_copy);
 
         return false;
     }
 
-    field->value = co_string_duplicate(value);
-
-    if (field->value == NULL)
-    {
-        co_string_destroy(field->name);
-        co_mem_free(field);
-
-        return false;
-    }
-
-    return co_list_add_tail(header->field_list, field);
+    return true;
 }
 
 void
@@ -419,9 +733,14 @@ co_http_header_remove_field(
     const char* name
 )
 {
-    co_http_header_field_t find_field = { (char*)name, NULL };
+    co_list_iterator_t* it = co_http_header_find(
+        header, name, co_http_header_hash(name));
 
-    co_list_remove(header->field_list, &find_field);
+    if (it != NULL)
+    {
+        co_list_remove_at(header->field_list, it);
+        co_http_header_rebuild_index(header);
+    }
 }
 
 void
@@ -430,8 +749,13 @@ co_http_header_remove_all_fields(
     const char* name
 )
 {
-    co_list_iterator_t* it =
-        co_list_get_head_iterator(header->field_list);
+    co_list_iterator_t* it = co_http_header_find(
+        header, name, co_http_header_hash(name));
+
+    if (it == NULL)
+    {
+        return;
+    }
 
     while (it != NULL)
     {
@@ -450,6 +774,8 @@ co_http_header_remove_all_fields(
             it = co_list_get_next_iterator(header->field_list, it);
         }
     }
+
+    co_http_header_rebuild_index(header);
 }
 
 void
@@ -472,8 +798,8 @@ co_http_header_get_content_length(
 )
 {
     const char* value =
-        co_http_header_get_field(
-            header, CO_HTTP_HEADER_CONTENT_LENGTH);
+        co_http_header_get_field_by_id(
+            header, CO_HTTP_HEADER_ID_CONTENT_LENGTH);
 
     if (value == NULL)
     {
@@ -496,8 +822,8 @@ co_http_header_set_keep_alive(
 )
 {
     const char* value =
-        co_http_header_get_field(
-            header, CO_HTTP_HEADER_CONNECTION);
+        co_http_header_get_field_by_id(
+            header, CO_HTTP_HEADER_ID_CONNECTION);
 
     if (value != NULL)
     {
@@ -531,8 +857,8 @@ co_http_header_get_keep_alive(
 )
 {
     const char* value =
-        co_http_header_get_field(
-            header, CO_HTTP_HEADER_CONNECTION);
+        co_http_header_get_field_by_id(
+            header, CO_HTTP_HEADER_ID_CONNECTION);
 
     if (value == NULL)
     {
@@ -2,6 +2,8 @@
 #include <coldforce/core/co_string.h>
 
 #include <coldforce/http/co_http_message.h>
+#include <coldforce/http/co_http_config.h>
+#include <coldforce/http/co_http_scan.h>
 
 //---------------------------------------------------------------------------//
 // http message
@@ -23,6 +25,11 @@ co_http_message_setup(
 
     message->data.ptr = NULL;
     message->data.size = 0;
+
+    message->parser.stage = CO_HTTP_MESSAGE_PARSE_START_LINE;
+    message->parser.offset = 0;
+    message->parser.scan_size = 0;
+    message->parser.zero_copy = false;
 }
 
 void
@@ -39,7 +46,7 @@ co_http_message_cleanup(
 }
 
 void
-co_http_message_serialize(
+co_http_message_serialize_header(
     const co_http_message_t* message,
     co_byte_array_t* buffer
 )
@@ -47,6 +54,15 @@ co_http_message_serialize(
     co_http_header_serialize(&message->header, buffer);
 
     co_byte_array_add_string(buffer, CO_HTTP_CRLF);
+}
+
+void
+co_http_message_serialize(
+    const co_http_message_t* message,
+    co_byte_array_t* buffer
+)
+{
+    co_http_message_serialize_header(message, buffer);
 
     if ((message->data.ptr != NULL) &&
         (message->data.size > 0))
@@ -56,6 +72,78 @@ co_http_message_serialize(
     }
 }
 
+int
+co_http_message_read_line(
+    co_http_message_t* message,
+    const co_byte_array_t* data,
+    size_t index,
+    const char** line,
+    size_t* line_length
+)
+{
+    const size_t line_start = index + message->parser.offset;
+    const size_t data_size = co_byte_array_get_count(data);
+
+    if (data_size <= line_start)
+    {
+        return CO_HTTP_PARSE_MORE_DATA;
+    }
+
+    const char* data_ptr =
+        (const char*)co_byte_array_get_const_ptr(data, line_start);
+    const size_t available_size = data_size - line_start;
+
+    const size_t max_header_line_size =
+        co_http_config_get_max_receive_header_line_size();
+
+    // resume the search where the previous read stopped,
+    // one byte back in case it ended between CR and LF
+    const size_t scan_start =
+        (message->parser.scan_size > 0) ?
+            (message->parser.scan_size - 1) : 0;
+
+    const char* new_line =
+        co_http_scan_crlf(&data_ptr[scan_start],
+            available_size - scan_start);
+
+    if (new_line == NULL)
+    {
+        message->parser.scan_size = available_size;
+
+        if (available_size > max_header_line_size)
+        {
+            return CO_HTTP_ERROR_HEADER_LINE_TOO_LONG;
+        }
+        else
+        {
+            return CO_HTTP_PARSE_MORE_DATA;
+        }
+    }
+
+    const size_t length = (new_line - data_ptr);
+
+    if (length > max_header_line_size)
+    {
+        return CO_HTTP_ERROR_HEADER_LINE_TOO_LONG;
+    }
+
+    message->parser.scan_size = 0;
+
+    *line = data_ptr;
+    *line_length = length;
+
+    return CO_HTTP_PARSE_COMPLETE;
+}
+
+void
+co_http_message_consume_line(
+    co_http_message_t* message,
+    size_t line_length
+)
+{
+    message->parser.offset += line_length + CO_HTTP_CRLF_LENGTH;
+}
+
 int
 co_http_message_deserialize_header(
     co_http_message_t* message,
@@ -63,7 +151,74 @@ co_http_message_deserialize_header(
     size_t* index
 )
 {
-    return co_http_header_deserialize(&message->header, data, index);
+    const size_t max_header_field_count =
+        co_http_config_get_max_receive_header_field_count();
+
+    while (message->parser.stage == CO_HTTP_MESSAGE_PARSE_HEADER)
+    {
+        if (co_http_header_get_field_count(&message->header) >
+            max_header_field_count)
+        {
+            return CO_HTTP_ERROR_HEADER_FIELDS_TOO_MANY;
+        }
+
+        const char* line = NULL;
+        size_t line_length = 0;
+
+        int result = co_http_message_read_line(
+            message, data, *index, &line, &line_length);
+
+        if (result != CO_HTTP_PARSE_COMPLETE)
+        {
+            return result;
+        }
+
+        if (line_length == 0)
+        {
+            result = co_http_header_validate_content_length(
+                &message->header);
+
+            if (result != CO_HTTP_PARSE_COMPLETE)
+            {
+                return result;
+            }
+
+            co_http_message_consume_line(message, line_length);
+
+            message->parser.stage = CO_HTTP_MESSAGE_PARSE_COMPLETE;
+        }
+        else
+        {
+            result = co_http_header_deserialize_field(
+                &message->header, line, line_length,
+                message->parser.zero_copy);
+
+            if (result != CO_HTTP_PARSE_COMPLETE)
+            {
+                return result;
+            }
+
+            co_http_message_consume_line(message, line_length);
+        }
+    }
+
+    if (message->parser.stage != CO_HTTP_MESSAGE_PARSE_COMPLETE)
+    {
+        return CO_HTTP_PARSE_ERROR;
+    }
+
+    (*index) += message->parser.offset;
+    message->parser.offset = 0;
+
+    return CO_HTTP_PARSE_COMPLETE;
+}
+
+bool
+co_http_message_is_header_complete(
+    const co_http_message_t* message
+)
+{
+    return (message->parser.stage == CO_HTTP_MESSAGE_PARSE_COMPLETE);
 }
 
 bool
@@ -0,0 +1,856 @@
+#include <coldforce/core/co_std.h>
+#include <coldforce/core/co_string.h>
+#include <coldforce/core/co_string_token.h>
+
+#include <coldforce/http/co_http_pool.h>
+#include <coldforce/http/co_http_log.h>
+
+//---------------------------------------------------------------------------//
+// http pool
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+static void
+co_http_pool_dispatch(
+    co_http_pool_t* pool,
+    co_http_pool_origin_t* origin
+);
+
+static bool
+co_http_pool_is_idempotent(
+    const co_http_request_t* request
+)
+{
+    const char* method = co_http_request_get_method(request);
+
+    return ((method != NULL) &&
+        ((strcmp(method, "GET") == 0) || (strcmp(method, "HEAD") == 0)));
+}
+
+static bool
+co_http_pool_has_close_token(
+    const co_http_header_t* header
+)
+{
+    const char* value = co_http_header_get_field_by_id(
+        header, CO_HTTP_HEADER_ID_CONNECTION);
+
+    if (value == NULL)
+    {
+        return false;
+    }
+
+    co_string_token_st tokens[8];
+    size_t token_count = co_string_token_split(value, tokens, 8);
+
+    bool result =
+        co_string_token_contains(tokens, token_count, "close");
+
+    co_string_token_cleanup(tokens, token_count);
+
+    return result;
+}
+
+static bool
+co_http_pool_is_keep_alive(
+    const co_http_request_t* request,
+    const co_http_response_t* response
+)
+{
+    if (co_http_pool_has_close_token(
+            co_http_request_get_const_header(request)) ||
+        co_http_pool_has_close_token(
+            co_http_response_get_const_header(response)))
+    {
+        return false;
+    }
+
+    const char* version = co_http_response_get_version(response);
+
+    if ((version != NULL) &&
+        (strcmp(version, CO_HTTP_VERSION_1_1) == 0))
+    {
+        return true;
+    }
+
+    // HTTP/1.0 closes unless asked otherwise
+    return co_http_header_get_keep_alive(
+        co_http_response_get_const_header(response));
+}
+
+static void
+co_http_pool_finish(
+    co_http_pool_t* pool,
+    co_http_pool_pending_t* pending,
+    const co_http_request_t* request,
+    const co_http_response_t* response,
+    int error_code
+)
+{
+    if (pool->callbacks.on_receive_finish != NULL)
+    {
+        pool->callbacks.on_receive_finish(
+            pool->owner_thread, pool,
+            request, response, error_code, pending->user_data);
+    }
+
+    co_mem_free(pending);
+}
+
+static void
+co_http_pool_connection_destroy(
+    co_http_pool_connection_t* conn
+)
+{
+    if (!conn->closed)
+    {
+        co_list_remove(conn->origin->connection_list, conn);
+
+        conn->closed = true;
+        conn->connected = false;
+        conn->reusable = false;
+    }
+
+    if (conn->in_callback)
+    {
+        return;
+    }
+
+    co_timer_destroy(conn->idle_timer);
+
+    // the client owns the requests that were sent
+    co_http_client_destroy(conn->client);
+
+    co_list_iterator_t* it = co_list_get_head_iterator(conn->send_queue);
+
+    while (it != NULL)
+    {
+        co_mem_free(co_list_get_next(conn->send_queue, &it)->value);
+    }
+
+    co_list_destroy(conn->send_queue);
+    co_mem_free(conn);
+}
+
+static void
+co_http_pool_connection_fail(
+    co_http_pool_connection_t* conn,
+    const co_http_request_t* request,
+    int error_code
+)
+{
+    co_http_pool_t* pool = conn->pool;
+    co_http_pool_origin_t* origin = conn->origin;
+
+    // the callbacks can send requests, this one is not picked
+    conn->connected = false;
+    conn->reusable = false;
+
+    while (co_list_get_count(conn->send_queue) > 0)
+    {
+        co_http_pool_pending_t* pending =
+            (co_http_pool_pending_t*)co_list_get_head(
+                conn->send_queue)->value;
+
+        co_list_remove_head(conn->send_queue);
+
+        co_http_pool_finish(pool, pending,
+            ((pending->request == request) ? request : NULL),
+            NULL, error_code);
+    }
+
+    co_http_pool_connection_destroy(conn);
+    co_http_pool_dispatch(pool, origin);
+}
+
+static void
+co_http_pool_fail_waiting(
+    co_http_pool_t* pool,
+    co_http_pool_origin_t* origin,
+    int error_code
+)
+{
+    while (co_list_get_count(origin->wait_queue) > 0)
+    {
+        co_http_pool_pending_t* pending =
+            (co_http_pool_pending_t*)co_list_get_head(
+                origin->wait_queue)->value;
+
+        co_list_remove_head(origin->wait_queue);
+
+        co_http_request_t* request = pending->request;
+
+        co_http_pool_finish(pool, pending, request, NULL, error_code);
+        co_http_request_destroy(request);
+    }
+}
+
+static void
+co_http_pool_on_idle_timer(
+    co_thread_t* thread,
+    co_timer_t* timer
+)
+{
+    (void)thread;
+
+    co_http_pool_connection_t* conn =
+        (co_http_pool_connection_t*)timer->user_data;
+
+    co_http_log_debug(NULL, NULL, NULL,
+        "http pool close idle connection (%s)", conn->origin->url_origin);
+
+    co_http_pool_connection_destroy(conn);
+}
+
+static void
+co_http_pool_on_connect(
+    co_thread_t* thread,
+    co_http_client_t* client,
+    int error_code
+)
+{
+    (void)thread;
+
+    co_http_pool_connection_t* conn =
+        (co_http_pool_connection_t*)co_http_get_user_data(client);
+    co_http_pool_t* pool = conn->pool;
+    co_http_pool_origin_t* origin = conn->origin;
+
+    if (error_code != 0)
+    {
+        co_http_pool_connection_destroy(conn);
+
+        // the requests wait on while another connection is left
+        if (co_list_get_count(origin->connection_list) == 0)
+        {
+            co_http_pool_fail_waiting(pool, origin, error_code);
+        }
+
+        return;
+    }
+
+    ++pool->stats.handshake_count;
+
+    conn->connected = true;
+
+    co_http_pool_dispatch(pool, origin);
+
+    // nothing was waiting for it, or another connection took it.
+    // a failed send in the dispatch may have destroyed this one
+    if (co_list_contains(origin->connection_list, conn) &&
+        (co_list_get_count(conn->send_queue) == 0))
+    {
+        co_timer_set_time(conn->idle_timer, pool->idle_timeout);
+        co_timer_start(conn->idle_timer);
+    }
+}
+
+static void
+co_http_pool_on_receive_finish(
+    co_thread_t* thread,
+    co_http_client_t* client,
+    const co_http_request_t* request,
+    const co_http_response_t* response,
+    int error_code
+)
+{
+    (void)thread;
+
+    co_http_pool_connection_t* conn =
+        (co_http_pool_connection_t*)co_http_get_user_data(client);
+    co_http_pool_t* pool = conn->pool;
+    co_http_pool_origin_t* origin = conn->origin;
+
+    if (error_code != 0)
+    {
+        // the client has dropped every request it was sent
+        co_http_pool_connection_fail(conn, request, error_code);
+
+        return;
+    }
+
+    co_http_pool_pending_t* pending =
+        (co_http_pool_pending_t*)co_list_get_head(conn->send_queue)->value;
+
+    co_list_remove_head(conn->send_queue);
+
+    ++conn->served_count;
+
+    if (!co_http_pool_is_keep_alive(request, response))
+    {
+        conn->reusable = false;
+    }
+
+    // the callback can send on this connection, and fail it
+    conn->in_callback = true;
+
+    co_http_pool_finish(pool, pending, request, response, 0);
+
+    conn->in_callback = false;
+
+    if (conn->closed)
+    {
+        co_http_pool_connection_destroy(conn);
+
+        return;
+    }
+
+    if (co_list_get_count(conn->send_queue) > 0)
+    {
+        return;
+    }
+
+    if (!conn->reusable)
+    {
+        co_http_pool_connection_destroy(conn);
+    }
+    else
+    {
+        // the timeout may have been changed since the connection opened
+        co_timer_set_time(conn->idle_timer, pool->idle_timeout);
+        co_timer_start(conn->idle_timer);
+    }
+
+    co_http_pool_dispatch(pool, origin);
+}
+
+static void
+co_http_pool_on_close(
+    co_thread_t* thread,
+    co_http_client_t* client
+)
+{
+    (void)thread;
+
+    co_http_pool_connection_t* conn =
+        (co_http_pool_connection_t*)co_http_get_user_data(client);
+    co_http_pool_origin_t* origin = conn->origin;
+
+    // a keep-alive connection can be closed by the peer just as a
+    // request goes out, an idempotent one is sent again
+    co_list_iterator_t* it = co_list_get_tail_iterator(conn->send_queue);
+
+    while (it != NULL)
+    {
+        co_list_iterator_t* prev_it =
+            co_list_get_prev_iterator(conn->send_queue, it);
+
+        co_http_pool_pending_t* pending =
+            (co_http_pool_pending_t*)it->data.value;
+
+        if (pending->reused && !pending->retried &&
+            (client->request != pending->request) &&
+            co_http_pool_is_idempotent(pending->request))
+        {
+            co_list_remove(client->request_queue, pending->request);
+            co_list_remove_at(conn->send_queue, it);
+
+            pending->retried = true;
+
+            co_list_add_head(origin->wait_queue, pending);
+        }
+
+        it = prev_it;
+    }
+
+    co_http_pool_connection_fail(
+        conn, NULL, CO_HTTP_ERROR_CONNECTION_CLOSED);
+}
+
+static co_http_pool_connection_t*
+co_http_pool_connection_create(
+    co_http_pool_t* pool,
+    co_http_pool_origin_t* origin
+)
+{
+    co_http_pool_connection_t* conn =
+        (co_http_pool_connection_t*)co_mem_alloc(
+            sizeof(co_http_pool_connection_t));
+
+    if (conn == NULL)
+    {
+        return NULL;
+    }
+
+    co_tls_ctx_st* tls_ctx = NULL;
+
+#ifdef CO_USE_OPENSSL_COMPATIBLE
+    if ((pool->tls_ctx.ssl_ctx != NULL) &&
+        (co_string_case_compare_n(origin->url_origin, "https:", 6) == 0))
+    {
+        // released by the tls client
+        SSL_CTX_up_ref(pool->tls_ctx.ssl_ctx);
+
+        tls_ctx = &pool->tls_ctx;
+    }
+#endif
+
+    conn->client = co_http_client_create(
+        origin->url_origin, &pool->local_net_addr, tls_ctx);
+
+    if (conn->client == NULL)
+    {
+#ifdef CO_USE_OPENSSL_COMPATIBLE
+        if (tls_ctx != NULL)
+        {
+            SSL_CTX_free(tls_ctx->ssl_ctx);
+        }
+#endif
+        co_mem_free(conn);
+
+        return NULL;
+    }
+
+    conn->pool = pool;
+    conn->origin = origin;
+    conn->idle_timer = co_timer_create(pool->idle_timeout,
+        (co_timer_fn)co_http_pool_on_idle_timer, false, conn);
+    conn->connected = false;
+    conn->reusable = true;
+    conn->served_count = 0;
+    conn->in_callback = false;
+    conn->closed = false;
+    conn->send_queue = co_list_create(NULL);
+
+    co_http_set_user_data(conn->client, conn);
+
+    co_http_callbacks_st* callbacks =
+        co_http_get_callbacks(conn->client);
+
+    callbacks->on_connect =
+        (co_http_connect_fn)co_http_pool_on_connect;
+    callbacks->on_receive_finish =
+        (co_http_receive_finish_fn)co_http_pool_on_receive_finish;
+    callbacks->on_close =
+        (co_http_close_fn)co_http_pool_on_close;
+
+    co_list_add_tail(origin->connection_list, conn);
+
+    if (!co_http_connect_start(conn->client))
+    {
+        co_http_pool_connection_destroy(conn);
+
+        return NULL;
+    }
+
+    return conn;
+}
+
+static co_http_pool_connection_t*
+co_http_pool_find_connection(
+    co_http_pool_t* pool,
+    co_http_pool_origin_t* origin,
+    const co_http_request_t* request
+)
+{
+    const bool pipelining =
+        (pool->max_pipeline_depth > 1) &&
+        co_http_pool_is_idempotent(request);
+
+    co_http_pool_connection_t* found = NULL;
+
+    co_list_iterator_t* it =
+        co_list_get_head_iterator(origin->connection_list);
+
+    while (it != NULL)
+    {
+        co_http_pool_connection_t* conn =
+            (co_http_pool_connection_t*)co_list_get_next(
+                origin->connection_list, &it)->value;
+
+        if (!conn->connected || !conn->reusable)
+        {
+            continue;
+        }
+
+        const size_t depth = co_list_get_count(conn->send_queue);
+
+        if (depth == 0)
+        {
+            return conn;
+        }
+
+        // behind the least busy connection that has room
+        if (pipelining && (depth < pool->max_pipeline_depth) &&
+            ((found == NULL) ||
+                (depth < co_list_get_count(found->send_queue))))
+        {
+            found = conn;
+        }
+    }
+
+    return found;
+}
+
+static size_t
+co_http_pool_get_connecting_count(
+    const co_http_pool_origin_t* origin
+)
+{
+    size_t count = 0;
+
+    const co_list_iterator_t* it =
+        co_list_get_const_head_iterator(origin->connection_list);
+
+    while (it != NULL)
+    {
+        const co_http_pool_connection_t* conn =
+            (const co_http_pool_connection_t*)co_list_get_const_next(
+                origin->connection_list, &it)->value;
+
+        if (!conn->connected)
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+static void
+co_http_pool_connection_send(
+    co_http_pool_connection_t* conn,
+    co_http_pool_pending_t* pending
+)
+{
+    co_http_pool_t* pool = conn->pool;
+
+    pending->reused =
+        ((conn->served_count > 0) ||
+            (co_list_get_count(conn->send_queue) > 0));
+
+    if (pending->reused)
+    {
+        ++pool->stats.hit_count;
+    }
+    else
+    {
+        ++pool->stats.miss_count;
+    }
+
+    co_timer_stop(conn->idle_timer);
+
+    co_http_request_t* request = pending->request;
+
+    co_list_add_tail(conn->send_queue, pending);
+
+    if (!co_http_send_request(conn->client, request))
+    {
+        // not taken over by the client
+        co_list_remove_tail(conn->send_queue);
+
+        co_http_pool_connection_fail(
+            conn, NULL, CO_HTTP_ERROR_CONNECTION_CLOSED);
+
+        co_http_pool_finish(pool, pending,
+            request, NULL, CO_HTTP_ERROR_CONNECTION_CLOSED);
+        co_http_request_destroy(request);
+    }
+}
+
+static void
+co_http_pool_dispatch(
+    co_http_pool_t* pool,
+    co_http_pool_origin_t* origin
+)
+{
+    while (co_list_get_count(origin->wait_queue) > 0)
+    {
+        co_http_pool_pending_t* pending =
+            (co_http_pool_pending_t*)co_list_get_head(
+                origin->wait_queue)->value;
+
+        co_http_pool_connection_t* conn =
+            co_http_pool_find_connection(pool, origin, pending->request);
+
+        if (conn != NULL)
+        {
+            co_list_remove_head(origin->wait_queue);
+            co_http_pool_connection_send(conn, pending);
+
+            continue;
+        }
+
+        // one new connection for each request no connecting one takes
+        if ((co_list_get_count(origin->connection_list) >=
+                pool->max_connections_per_origin) ||
+            (co_http_pool_get_connecting_count(origin) >=
+                co_list_get_count(origin->wait_queue)))
+        {
+            break;
+        }
+
+        if (co_http_pool_connection_create(pool, origin) == NULL)
+        {
+            if (co_list_get_count(origin->connection_list) == 0)
+            {
+                co_http_pool_fail_waiting(
+                    pool, origin, CO_HTTP_ERROR_CONNECT_FAILED);
+            }
+
+            break;
+        }
+    }
+}
+
+static void
+co_http_pool_origin_destroy(
+    co_http_pool_origin_t* origin
+)
+{
+    while (co_list_get_count(origin->connection_list) > 0)
+    {
+        co_http_pool_connection_destroy(
+            (co_http_pool_connection_t*)co_list_get_head(
+                origin->connection_list)->value);
+    }
+
+    while (co_list_get_count(origin->wait_queue) > 0)
+    {
+        co_http_pool_pending_t* pending =
+            (co_http_pool_pending_t*)co_list_get_head(
+                origin->wait_queue)->value;
+
+        co_list_remove_head(origin->wait_queue);
+
+        co_http_request_destroy(pending->request);
+        co_mem_free(pending);
+    }
+
+    co_list_destroy(origin->connection_list);
+    co_list_destroy(origin->wait_queue);
+    co_string_destroy(origin->url_origin);
+    co_mem_free(origin);
+}
+
+static co_http_pool_origin_t*
+co_http_pool_get_origin(
+    co_http_pool_t* pool,
+    const char* url_origin
+)
+{
+    co_map_data_st* data = co_map_get(pool->origin_map, url_origin);
+
+    if (data != NULL)
+    {
+        return (co_http_pool_origin_t*)data->value;
+    }
+
+    co_http_pool_origin_t* origin =
+        (co_http_pool_origin_t*)co_mem_alloc(
+            sizeof(co_http_pool_origin_t));
+
+    if (origin == NULL)
+    {
+        return NULL;
+    }
+
+    origin->url_origin = co_string_duplicate(url_origin);
+    origin->connection_list = co_list_create(NULL);
+    origin->wait_queue = co_list_create(NULL);
+
+    if (!co_map_set(pool->origin_map, origin->url_origin, origin))
+    {
+        co_http_pool_origin_destroy(origin);
+
+        return NULL;
+    }
+
+    return origin;
+}
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+co_http_pool_t*
+co_http_pool_create(
+    const co_net_addr_t* local_net_addr,
+    co_tls_ctx_st* tls_ctx
+)
+{
+    co_http_pool_t* pool =
+        (co_http_pool_t*)co_mem_alloc(sizeof(co_http_pool_t));
+
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+
+    pool->owner_thread = co_thread_get_current();
+
+    if (local_net_addr != NULL)
+    {
+        memcpy(&pool->local_net_addr,
+            local_net_addr, sizeof(co_net_addr_t));
+    }
+    else
+    {
+        co_net_addr_init(&pool->local_net_addr);
+        co_net_addr_set_family(
+            &pool->local_net_addr, CO_NET_ADDR_FAMILY_IPV4);
+    }
+
+    if (tls_ctx != NULL)
+    {
+        pool->tls_ctx = *tls_ctx;
+    }
+    else
+    {
+        memset(&pool->tls_ctx, 0x00, sizeof(co_tls_ctx_st));
+    }
+
+    pool->callbacks.on_receive_finish = NULL;
+
+    pool->max_connections_per_origin =
+        CO_HTTP_POOL_DEFAULT_MAX_CONNECTIONS_PER_ORIGIN;
+    pool->idle_timeout = CO_HTTP_POOL_DEFAULT_IDLE_TIMEOUT;
+    pool->max_pipeline_depth = CO_HTTP_POOL_DEFAULT_MAX_PIPELINE_DEPTH;
+
+    co_map_ctx_st map_ctx = { 0 };
+    map_ctx.hash_key = (co_item_hash_fn)co_string_hash;
+    map_ctx.compare_keys = (co_item_compare_fn)strcmp;
+    map_ctx.destroy_value =
+        (co_item_destroy_fn)co_http_pool_origin_destroy;
+
+    // the key is the url_origin of the value
+    pool->origin_map = co_map_create(&map_ctx);
+
+    pool->stats.hit_count = 0;
+    pool->stats.miss_count = 0;
+    pool->stats.handshake_count = 0;
+
+    return pool;
+}
+
+void
+co_http_pool_destroy(
+    co_http_pool_t* pool
+)
+{
+    if (pool != NULL)
+    {
+        co_map_destroy(pool->origin_map);
+
+#ifdef CO_USE_OPENSSL_COMPATIBLE
+        if (pool->tls_ctx.ssl_ctx != NULL)
+        {
+            SSL_CTX_free(pool->tls_ctx.ssl_ctx);
+        }
+#endif
+        co_mem_free(pool);
+    }
+}
+
+co_http_pool_callbacks_st*
+co_http_pool_get_callbacks(
+    co_http_pool_t* pool
+)
+{
+    return &pool->callbacks;
+}
+
+void
+co_http_pool_set_max_connections_per_origin(
+    co_http_pool_t* pool,
+    size_t max_connection_count
+)
+{
+    pool->max_connections_per_origin =
+        (max_connection_count > 0) ? max_connection_count : 1;
+}
+
+void
+co_http_pool_set_idle_timeout(
+    co_http_pool_t* pool,
+    uint32_t msec
+)
+{
+    pool->idle_timeout = msec;
+}
+
+void
+co_http_pool_set_max_pipeline_depth(
+    co_http_pool_t* pool,
+    size_t max_depth
+)
+{
+    pool->max_pipeline_depth = (max_depth > 0) ? max_depth : 1;
+}
+
+bool
+co_http_pool_send_request(
+    co_http_pool_t* pool,
+    const char* url_origin,
+    co_http_request_t* request,
+    void* request_user_data
+)
+{
+    co_http_pool_origin_t* origin =
+        co_http_pool_get_origin(pool, url_origin);
+
+    if (origin == NULL)
+    {
+        return false;
+    }
+
+    co_http_pool_pending_t* pending =
+        (co_http_pool_pending_t*)co_mem_alloc(
+            sizeof(co_http_pool_pending_t));
+
+    if (pending == NULL)
+    {
+        return false;
+    }
+
+    if (co_http_request_get_version(request) == NULL)
+    {
+        co_http_request_set_version(request, CO_HTTP_VERSION_1_1);
+    }
+
+    pending->request = request;
+    pending->user_data = request_user_data;
+    pending->reused = false;
+    pending->retried = false;
+
+    co_list_add_tail(origin->wait_queue, pending);
+
+    co_http_pool_dispatch(pool, origin);
+
+    return true;
+}
+
+const co_http_pool_stats_st*
+co_http_pool_get_stats(
+    const co_http_pool_t* pool
+)
+{
+    return &pool->stats;
+}
+
+size_t
+co_http_pool_get_connection_count(
+    const co_http_pool_t* pool,
+    const char* url_origin
+)
+{
+    const co_map_data_st* data =
+        co_map_get((co_map_t*)pool->origin_map, url_origin);
+
+    if (data == NULL)
+    {
+        return 0;
+    }
+
+    return co_list_get_count(
+        ((const co_http_pool_origin_t*)data->value)->connection_list);
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
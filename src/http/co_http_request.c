@@ -1,8 +1,10 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_string.h>
+#include <coldforce/core/co_mem_pool.h>
 
 #include <coldforce/http/co_http_request.h>
 #include <coldforce/http/co_http_config.h>
+#include <coldforce/http/co_http_scan.h>
 
 //---------------------------------------------------------------------------//
 // http request
@@ -15,8 +17,8 @@
 // private
 //---------------------------------------------------------------------------//
 
-void
-co_http_request_serialize(
+static void
+co_http_request_serialize_line(
     const co_http_request_t* request,
     co_byte_array_t* buffer
 )
@@ -28,51 +30,42 @@ co_http_request_serialize(
     co_byte_array_add_string(buffer, CO_HTTP_SP);
     co_byte_array_add_string(buffer, request->version);
     co_byte_array_add_string(buffer, CO_HTTP_CRLF);
+}
+
+void
+co_http_request_serialize_header(
+    const co_http_request_t* request,
+    co_byte_array_t* buffer
+)
+{
+    co_http_request_serialize_line(request, buffer);
+    co_http_message_serialize_header(&request->message, buffer);
+}
 
+void
+co_http_request_serialize(
+    const co_http_request_t* request,
+    co_byte_array_t* buffer
+)
+{
+    co_http_request_serialize_line(request, buffer);
     co_http_message_serialize(&request->message, buffer);
 }
 
-int
-co_http_request_deserialize(
+static int
+co_http_request_deserialize_line(
     co_http_request_t* request,
     const co_byte_array_t* data,
-    size_t* index
+    size_t index,
+    const char* data_ptr,
+    size_t length
 )
 {
-    const char* data_ptr =
-        (const char*)co_byte_array_get_const_ptr(data, *index);
-    const size_t data_size = co_byte_array_get_count(data) - (*index);
-
-    const char* new_line =
-        co_string_find_n(data_ptr, CO_HTTP_CRLF, data_size);
-
-    const size_t max_header_line_size =
-        co_http_config_get_max_receive_header_line_size();
-
-    if (new_line == NULL)
-    {
-        if (data_size > max_header_line_size)
-        {
-            return CO_HTTP_ERROR_HEADER_LINE_TOO_LONG;
-        }
-        else
-        {
-            return CO_HTTP_PARSE_MORE_DATA;
-        }
-    }
-
-    size_t length = (new_line - data_ptr);
-
-    if (length > max_header_line_size)
-    {
-        return CO_HTTP_ERROR_HEADER_LINE_TOO_LONG;
-    }
-
     size_t item_length = 0;
     size_t temp_index = 0;
 
     const char* sp =
-        co_string_find_n(&data_ptr[temp_index], " ", length);
+        co_http_scan_char(&data_ptr[temp_index], length, ' ');
 
     if (sp == NULL)
     {
@@ -94,15 +87,28 @@ co_http_request_deserialize(
         (strcmp(method, "CONNECT") != 0) &&
         (strcmp(method, "TRACE") != 0))
     {
+        const size_t data_size = co_byte_array_get_count(data) - index;
+
+        if ((data_size < 24) &&
+            (memcmp(data_ptr,
+                "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n", data_size) == 0))
+        {
+            co_string_destroy(method);
+
+            return CO_HTTP_PARSE_MORE_DATA;
+        }
+
         if ((data_size >= 24) &&
-            (memcmp(&data_ptr[temp_index],
+            (memcmp(data_ptr,
                 "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n", 24) == 0))
         {
             request->method = method;
             request->url = co_url_create("*");
             request->version = co_string_duplicate("HTTP/2.0");
 
-            (*index) += 24;
+            request->message.parser.offset = 24;
+            request->message.parser.stage =
+                CO_HTTP_MESSAGE_PARSE_COMPLETE;
 
             return CO_HTTP_PARSE_COMPLETE;
         }
@@ -115,7 +121,7 @@ co_http_request_deserialize(
     length -= (item_length + 1);
     temp_index += (item_length + 1);
 
-    sp = co_string_find_n(&data_ptr[temp_index], " ", length);
+    sp = co_http_scan_char(&data_ptr[temp_index], length, ' ');
 
     if (sp == NULL)
     {
@@ -130,6 +136,8 @@ co_http_request_deserialize(
 
     co_url_st* url = co_url_create(url_str);
 
+    co_string_destroy(url_str);
+
     if (url->path == NULL)
     {
         co_string_destroy(method);
@@ -149,20 +157,49 @@ co_http_request_deserialize(
     request->url = url;
     request->version = version;
 
-    co_string_destroy(url_str);
+    co_http_message_consume_line(
+        &request->message, temp_index + item_length);
 
-    temp_index += (item_length + CO_HTTP_CRLF_LENGTH) + (*index);
+    request->message.parser.stage = CO_HTTP_MESSAGE_PARSE_HEADER;
 
-    int result =
-        co_http_message_deserialize_header(
-            &request->message, data, &temp_index);
+    return CO_HTTP_PARSE_COMPLETE;
+}
+
+int
+co_http_request_deserialize(
+    co_http_request_t* request,
+    const co_byte_array_t* data,
+    size_t* index
+)
+{
+    // resumable, a request that returned CO_HTTP_PARSE_MORE_DATA
+    // continues from the line it stopped at on the next call
 
-    if (result == CO_HTTP_PARSE_COMPLETE)
+    if (request->message.parser.stage ==
+        CO_HTTP_MESSAGE_PARSE_START_LINE)
     {
-        (*index) = temp_index;
+        const char* line = NULL;
+        size_t line_length = 0;
+
+        int result = co_http_message_read_line(
+            &request->message, data, *index, &line, &line_length);
+
+        if (result != CO_HTTP_PARSE_COMPLETE)
+        {
+            return result;
+        }
+
+        result = co_http_request_deserialize_line(
+            request, data, *index, line, line_length);
+
+        if (result != CO_HTTP_PARSE_COMPLETE)
+        {
+            return result;
+        }
     }
 
-    return result;
+    return co_http_message_deserialize_header(
+        &request->message, data, index);
 }
 
 //---------------------------------------------------------------------------//
@@ -176,7 +213,7 @@ co_http_request_create(
 )
 {
     co_http_request_t* request =
-        (co_http_request_t*)co_mem_alloc(sizeof(co_http_request_t));
+        (co_http_request_t*)co_mem_pool_alloc(sizeof(co_http_request_t));
 
     if (request == NULL)
     {
@@ -212,7 +249,7 @@ co_http_request_destroy(
         co_url_destroy(request->url);
         co_http_message_cleanup(&request->message);
 
-        co_mem_free(request);
+        co_mem_pool_free(request);
     }
 }
 
@@ -382,8 +419,8 @@ co_http_request_add_cookie(
     const co_http_cookie_st* cookie
 )
 {
-    const char* value = co_http_header_get_field(
-        &request->message.header, CO_HTTP_HEADER_COOKIE);
+    const char* value = co_http_header_get_field_by_id(
+        &request->message.header, CO_HTTP_HEADER_ID_COOKIE);
 
     if (value != NULL)
     {
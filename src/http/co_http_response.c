@@ -1,8 +1,10 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_string.h>
+#include <coldforce/core/co_mem_pool.h>
 
 #include <coldforce/http/co_http_response.h>
 #include <coldforce/http/co_http_config.h>
+#include <coldforce/http/co_http_scan.h>
 
 //---------------------------------------------------------------------------//
 // http response
@@ -11,16 +13,71 @@
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+typedef struct
+{
+    uint16_t status_code;
+    const char* reason_phrase;
+    const char* line;
+
+} co_http_response_status_line_st;
+
+// HTTP/1.1 status lines with the standard reason phrase
+static const co_http_response_status_line_st
+    co_http_response_status_lines[] =
+{
+    { 200, "OK", "HTTP/1.1 200 OK\r\n" },
+    { 201, "Created", "HTTP/1.1 201 Created\r\n" },
+    { 204, "No Content", "HTTP/1.1 204 No Content\r\n" },
+    { 206, "Partial Content", "HTTP/1.1 206 Partial Content\r\n" },
+    { 301, "Moved Permanently", "HTTP/1.1 301 Moved Permanently\r\n" },
+    { 302, "Found", "HTTP/1.1 302 Found\r\n" },
+    { 304, "Not Modified", "HTTP/1.1 304 Not Modified\r\n" },
+    { 400, "Bad Request", "HTTP/1.1 400 Bad Request\r\n" },
+    { 401, "Unauthorized", "HTTP/1.1 401 Unauthorized\r\n" },
+    { 403, "Forbidden", "HTTP/1.1 403 Forbidden\r\n" },
+    { 404, "Not Found", "HTTP/1.1 404 Not Found\r\n" },
+    { 500, "Internal Server Error",
+        "HTTP/1.1 500 Internal Server Error\r\n" },
+    { 503, "Service Unavailable", "HTTP/1.1 503 Service Unavailable\r\n" }
+};
+
 //---------------------------------------------------------------------------//
 // private
 //---------------------------------------------------------------------------//
 
 void
-co_http_response_serialize(
+co_http_response_serialize_line(
     const co_http_response_t* response,
     co_byte_array_t* buffer
 )
 {
+    if (strcmp(response->version, CO_HTTP_VERSION_1_1) == 0)
+    {
+        const size_t count =
+            sizeof(co_http_response_status_lines) /
+                sizeof(co_http_response_status_line_st);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            const co_http_response_status_line_st* status_line =
+                &co_http_response_status_lines[index];
+
+            if (status_line->status_code == response->status_code)
+            {
+                if ((response->reason_phrase != NULL) &&
+                    (strcmp(status_line->reason_phrase,
+                        response->reason_phrase) == 0))
+                {
+                    co_byte_array_add_string(buffer, status_line->line);
+
+                    return;
+                }
+
+                break;
+            }
+        }
+    }
+
     co_byte_array_add_string(buffer, response->version);
     co_byte_array_add_string(buffer, CO_HTTP_SP);
 
@@ -31,53 +88,40 @@ co_http_response_serialize(
     co_byte_array_add_string(buffer, CO_HTTP_SP);
     co_byte_array_add_string(buffer, response->reason_phrase);
     co_byte_array_add_string(buffer, CO_HTTP_CRLF);
+}
 
+void
+co_http_response_serialize_header(
+    const co_http_response_t* response,
+    co_byte_array_t* buffer
+)
+{
+    co_http_response_serialize_line(response, buffer);
+    co_http_message_serialize_header(&response->message, buffer);
+}
+
+void
+co_http_response_serialize(
+    const co_http_response_t* response,
+    co_byte_array_t* buffer
+)
+{
+    co_http_response_serialize_line(response, buffer);
     co_http_message_serialize(&response->message, buffer);
 }
 
-int
-co_http_response_deserialize(
+static int
+co_http_response_deserialize_line(
     co_http_response_t* response,
-    const co_byte_array_t* data,
-    size_t* index
+    const char* data_ptr,
+    size_t length
 )
 {
-    const char* data_ptr =
-        (const char*)co_byte_array_get_const_ptr(data, *index);
-    const size_t data_size = co_byte_array_get_count(data) - (*index);
-
-    const char* new_line =
-        co_string_find_n(data_ptr, CO_HTTP_CRLF, data_size);
-
-    const size_t max_header_line_size =
-        co_http_config_get_max_receive_header_line_size();
-
-    if (new_line == NULL)
-    {
-        if (data_size > max_header_line_size)
-        {
-            return CO_HTTP_ERROR_HEADER_LINE_TOO_LONG;
-        }
-        else
-        {
-            return CO_HTTP_PARSE_MORE_DATA;
-        }
-    }
-
-    size_t length = (new_line - data_ptr);
-
-    if (length > max_header_line_size)
-    {
-        return CO_HTTP_ERROR_HEADER_LINE_TOO_LONG;
-    }
-
     size_t item_length = 0;
     size_t temp_index = 0;
 
-    length -= temp_index;
-
     const char* sp =
-        co_string_find_n(&data_ptr[temp_index], " ", length);
+        co_http_scan_char(&data_ptr[temp_index], length, ' ');
 
     if (sp == NULL)
     {
@@ -92,7 +136,7 @@ co_http_response_deserialize(
     length -= (item_length + 1);
     temp_index += (item_length + 1);
 
-    sp = co_string_find_n(&data_ptr[temp_index], " ", length);
+    sp = co_http_scan_char(&data_ptr[temp_index], length, ' ');
 
     if (sp == NULL)
     {
@@ -123,18 +167,49 @@ co_http_response_deserialize(
     response->status_code = (uint16_t)status_code;
     response->reason_phrase = reason_phrase;
 
-    temp_index += (item_length + CO_HTTP_CRLF_LENGTH) + (*index);
+    co_http_message_consume_line(
+        &response->message, temp_index + item_length);
+
+    response->message.parser.stage = CO_HTTP_MESSAGE_PARSE_HEADER;
 
-    int result =
-        co_http_message_deserialize_header(
-            &response->message, data, &temp_index);
+    return CO_HTTP_PARSE_COMPLETE;
+}
+
+int
+co_http_response_deserialize(
+    co_http_response_t* response,
+    const co_byte_array_t* data,
+    size_t* index
+)
+{
+    // resumable, a response that returned CO_HTTP_PARSE_MORE_DATA
+    // continues from the line it stopped at on the next call
 
-    if (result == CO_HTTP_PARSE_COMPLETE)
+    if (response->message.parser.stage ==
+        CO_HTTP_MESSAGE_PARSE_START_LINE)
     {
-        (*index) = temp_index;
+        const char* line = NULL;
+        size_t line_length = 0;
+
+        int result = co_http_message_read_line(
+            &response->message, data, *index, &line, &line_length);
+
+        if (result != CO_HTTP_PARSE_COMPLETE)
+        {
+            return result;
+        }
+
+        result = co_http_response_deserialize_line(
+            response, line, line_length);
+
+        if (result != CO_HTTP_PARSE_COMPLETE)
+        {
+            return result;
+        }
     }
 
-    return result;
+    return co_http_message_deserialize_header(
+        &response->message, data, index);
 }
 
 //---------------------------------------------------------------------------//
@@ -148,7 +223,7 @@ co_http_response_create(
 )
 {
     co_http_response_t* response =
-        (co_http_response_t*)co_mem_alloc(sizeof(co_http_response_t));
+        (co_http_response_t*)co_mem_pool_alloc(sizeof(co_http_response_t));
 
     if (response == NULL)
     {
@@ -183,7 +258,7 @@ co_http_response_destroy(
 
         co_http_message_cleanup(&response->message);
 
-        co_mem_free(response);
+        co_mem_pool_free(response);
     }
 }
 
@@ -0,0 +1,169 @@
+#include <coldforce/core/co_std.h>
+#include <coldforce/core/co_string.h>
+
+#include <coldforce/http/co_http_response_template.h>
+
+//---------------------------------------------------------------------------//
+// http response template
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+size_t
+co_http_response_template_serialize_tail(
+    const co_http_response_template_t* response_template,
+    size_t data_size,
+    char* tail
+)
+{
+    // formatted by hand, this runs once per response
+
+    static const char content_length[] =
+        CO_HTTP_HEADER_CONTENT_LENGTH ": ";
+    static const char date[] =
+        CO_HTTP_HEADER_DATE ": ";
+
+    size_t length = 0;
+
+    if (response_template->content_length)
+    {
+        memcpy(&tail[length],
+            content_length, sizeof(content_length) - 1);
+        length += sizeof(content_length) - 1;
+
+        char digits[CO_SIZE_T_DEC_DIGIT_MAX];
+        size_t digit_count = 0;
+
+        do
+        {
+            digits[digit_count++] = (char)('0' + (data_size % 10));
+            data_size /= 10;
+
+        } while (data_size > 0);
+
+        while (digit_count > 0)
+        {
+            tail[length++] = digits[--digit_count];
+        }
+
+        memcpy(&tail[length], CO_HTTP_CRLF, CO_HTTP_CRLF_LENGTH);
+        length += CO_HTTP_CRLF_LENGTH;
+    }
+
+    if (response_template->date)
+    {
+        memcpy(&tail[length], date, sizeof(date) - 1);
+        length += sizeof(date) - 1;
+
+        memcpy(&tail[length],
+            co_http_get_current_date(), CO_HTTP_DATE_LENGTH);
+        length += CO_HTTP_DATE_LENGTH;
+
+        memcpy(&tail[length], CO_HTTP_CRLF, CO_HTTP_CRLF_LENGTH);
+        length += CO_HTTP_CRLF_LENGTH;
+    }
+
+    memcpy(&tail[length], CO_HTTP_CRLF, CO_HTTP_CRLF_LENGTH);
+    length += CO_HTTP_CRLF_LENGTH;
+
+    return length;
+}
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+co_http_response_template_t*
+co_http_response_template_create(
+    const co_http_response_t* response
+)
+{
+    co_http_response_template_t* response_template =
+        (co_http_response_template_t*)co_mem_alloc(
+            sizeof(co_http_response_template_t));
+
+    if (response_template == NULL)
+    {
+        return NULL;
+    }
+
+    response_template->header_block = co_byte_array_create();
+
+    if (response_template->header_block == NULL)
+    {
+        co_mem_free(response_template);
+
+        return NULL;
+    }
+
+    // 1xx and 204 must not have Content-Length, and in a 304 it
+    // would describe the selected representation (RFC 9110 8.6)
+    const uint16_t status_code =
+        co_http_response_get_status_code(response);
+
+    response_template->content_length =
+        (status_code >= 200) && (status_code != 204) &&
+        (status_code != 304);
+    response_template->date = true;
+
+    co_byte_array_t* buffer = response_template->header_block;
+
+    co_http_response_serialize_line(response, buffer);
+
+    const co_list_t* field_list = response->message.header.field_list;
+
+    const co_list_iterator_t* it =
+        co_list_get_const_head_iterator(field_list);
+
+    while (it != NULL)
+    {
+        const co_http_header_field_t* field =
+            (const co_http_header_field_t*)co_list_get_const_next(
+                field_list, &it)->value;
+
+        if ((co_string_case_compare(
+                field->name, CO_HTTP_HEADER_CONTENT_LENGTH) == 0) ||
+            (co_string_case_compare(
+                field->name, CO_HTTP_HEADER_DATE) == 0))
+        {
+            continue;
+        }
+
+        co_byte_array_add_string(buffer, field->name);
+        co_byte_array_add(buffer, CO_HTTP_COLON, 1);
+        co_byte_array_add(buffer, " ", 1);
+        co_byte_array_add_string(buffer, field->value);
+        co_byte_array_add(buffer, CO_HTTP_CRLF, 2);
+    }
+
+    return response_template;
+}
+
+void
+co_http_response_template_destroy(
+    co_http_response_template_t* response_template
+)
+{
+    if (response_template != NULL)
+    {
+        co_byte_array_destroy(response_template->header_block);
+        co_mem_free(response_template);
+    }
+}
+
+void
+co_http_response_template_set_date(
+    co_http_response_template_t* response_template,
+    bool enable
+)
+{
+    response_template->date = enable;
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
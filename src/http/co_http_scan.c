@@ -0,0 +1,462 @@
+#include <coldforce/core/co_std.h>
+
+#include <coldforce/http/co_http_scan.h>
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+#   if defined(__SSE2__) || defined(_M_X64) || \
+        (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#       define CO_HTTP_SCAN_SSE2
+#       include <emmintrin.h>
+#   endif
+#   if defined(_MSC_VER) || defined(__GNUC__)
+#       define CO_HTTP_SCAN_AVX2
+#       include <immintrin.h>
+#   endif
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   endif
+#endif
+
+#ifdef __GNUC__
+#   define CO_HTTP_SCAN_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#   define CO_HTTP_SCAN_TARGET_AVX2
+#endif
+
+//---------------------------------------------------------------------------//
+// http scan
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+#define CO_HTTP_SCAN_CHAR_TOKEN     0x01
+#define CO_HTTP_SCAN_CHAR_OWS       0x02
+
+#define T   CO_HTTP_SCAN_CHAR_TOKEN
+#define W   CO_HTTP_SCAN_CHAR_OWS
+
+// RFC 9110 tchar and OWS
+static const uint8_t co_http_scan_char_table[256] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, W, 0, 0, 0, 0, 0, 0, // 0x00
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x10
+    W, T, 0, T, T, T, T, T, 0, 0, T, T, 0, T, T, 0, // 0x20
+    T, T, T, T, T, T, T, T, T, T, 0, 0, 0, 0, 0, 0, // 0x30
+    0, T, T, T, T, T, T, T, T, T, T, T, T, T, T, T, // 0x40
+    T, T, T, T, T, T, T, T, T, T, T, 0, 0, 0, T, T, // 0x50
+    T, T, T, T, T, T, T, T, T, T, T, T, T, T, T, T, // 0x60
+    T, T, T, T, T, T, T, T, T, T, T, 0, T, 0, T, 0, // 0x70
+};
+
+#undef T
+#undef W
+
+typedef struct
+{
+    const char* (*find_crlf)(const char* data, size_t length);
+    const char* (*find_char)(const char* data, size_t length, char ch);
+
+} co_http_scan_ops_st;
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+#if defined(CO_HTTP_SCAN_SSE2) || defined(CO_HTTP_SCAN_AVX2)
+
+static size_t
+co_http_scan_bit_index(
+    uint32_t mask
+)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (size_t)index;
+#else
+    return (size_t)__builtin_ctz(mask);
+#endif
+}
+
+#endif
+
+static const char*
+co_http_scan_crlf_scalar(
+    const char* data,
+    size_t length
+)
+{
+    const char* end = data + length;
+
+    while (data < end)
+    {
+        const char* cr =
+            (const char*)memchr(data, '\r', (size_t)(end - data));
+
+        if ((cr == NULL) || ((cr + 1) >= end))
+        {
+            return NULL;
+        }
+
+        if (cr[1] == '\n')
+        {
+            return cr;
+        }
+
+        data = cr + 1;
+    }
+
+    return NULL;
+}
+
+static const char*
+co_http_scan_char_scalar(
+    const char* data,
+    size_t length,
+    char ch
+)
+{
+    return (const char*)memchr(data, ch, length);
+}
+
+#ifdef CO_HTTP_SCAN_SSE2
+
+static const char*
+co_http_scan_crlf_sse2(
+    const char* data,
+    size_t length
+)
+{
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+
+    size_t pos = 0;
+
+    // compare each byte with CR and the byte after it with LF
+    while ((pos + 16 + 1) <= length)
+    {
+        const __m128i block0 =
+            _mm_loadu_si128((const __m128i*)&data[pos]);
+        const __m128i block1 =
+            _mm_loadu_si128((const __m128i*)&data[pos + 1]);
+
+        const uint32_t mask = (uint32_t)_mm_movemask_epi8(
+            _mm_and_si128(
+                _mm_cmpeq_epi8(block0, cr), _mm_cmpeq_epi8(block1, lf)));
+
+        if (mask != 0)
+        {
+            return &data[pos + co_http_scan_bit_index(mask)];
+        }
+
+        pos += 16;
+    }
+
+    return co_http_scan_crlf_scalar(&data[pos], length - pos);
+}
+
+static const char*
+co_http_scan_char_sse2(
+    const char* data,
+    size_t length,
+    char ch
+)
+{
+    const __m128i needle = _mm_set1_epi8(ch);
+
+    size_t pos = 0;
+
+    while ((pos + 16) <= length)
+    {
+        const __m128i block =
+            _mm_loadu_si128((const __m128i*)&data[pos]);
+
+        const uint32_t mask = (uint32_t)_mm_movemask_epi8(
+            _mm_cmpeq_epi8(block, needle));
+
+        if (mask != 0)
+        {
+            return &data[pos + co_http_scan_bit_index(mask)];
+        }
+
+        pos += 16;
+    }
+
+    return co_http_scan_char_scalar(&data[pos], length - pos, ch);
+}
+
+#endif // CO_HTTP_SCAN_SSE2
+
+#ifdef CO_HTTP_SCAN_AVX2
+
+CO_HTTP_SCAN_TARGET_AVX2
+static const char*
+co_http_scan_crlf_avx2(
+    const char* data,
+    size_t length
+)
+{
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+
+    size_t pos = 0;
+
+    while ((pos + 32 + 1) <= length)
+    {
+        const __m256i block0 =
+            _mm256_loadu_si256((const __m256i*)&data[pos]);
+        const __m256i block1 =
+            _mm256_loadu_si256((const __m256i*)&data[pos + 1]);
+
+        const uint32_t mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_and_si256(
+                _mm256_cmpeq_epi8(block0, cr),
+                _mm256_cmpeq_epi8(block1, lf)));
+
+        if (mask != 0)
+        {
+            return &data[pos + co_http_scan_bit_index(mask)];
+        }
+
+        pos += 32;
+    }
+
+    return co_http_scan_crlf_scalar(&data[pos], length - pos);
+}
+
+CO_HTTP_SCAN_TARGET_AVX2
+static const char*
+co_http_scan_char_avx2(
+    const char* data,
+    size_t length,
+    char ch
+)
+{
+    const __m256i needle = _mm256_set1_epi8(ch);
+
+    size_t pos = 0;
+
+    while ((pos + 32) <= length)
+    {
+        const __m256i block =
+            _mm256_loadu_si256((const __m256i*)&data[pos]);
+
+        const uint32_t mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(block, needle));
+
+        if (mask != 0)
+        {
+            return &data[pos + co_http_scan_bit_index(mask)];
+        }
+
+        pos += 32;
+    }
+
+    return co_http_scan_char_scalar(&data[pos], length - pos, ch);
+}
+
+static bool
+co_http_scan_cpu_has_avx2(
+    void
+)
+{
+#ifdef _MSC_VER
+    int info[4];
+
+    __cpuid(info, 0);
+
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    // the os must save the ymm registers
+    __cpuid(info, 1);
+
+    if (((info[2] & (1 << 27)) == 0) ||
+        ((_xgetbv(0) & 0x06) != 0x06))
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+
+    return ((info[1] & (1 << 5)) != 0);
+#else
+    __builtin_cpu_init();
+
+    return (__builtin_cpu_supports("avx2") != 0);
+#endif
+}
+
+#endif // CO_HTTP_SCAN_AVX2
+
+static const co_http_scan_ops_st co_http_scan_ops_table[] =
+{
+    { co_http_scan_crlf_scalar, co_http_scan_char_scalar },
+#ifdef CO_HTTP_SCAN_SSE2
+    { co_http_scan_crlf_sse2, co_http_scan_char_sse2 },
+#else
+    { co_http_scan_crlf_scalar, co_http_scan_char_scalar },
+#endif
+#ifdef CO_HTTP_SCAN_AVX2
+    { co_http_scan_crlf_avx2, co_http_scan_char_avx2 },
+#else
+    { co_http_scan_crlf_scalar, co_http_scan_char_scalar },
+#endif
+};
+
+static const char* co_http_scan_crlf_resolve(const char*, size_t);
+static const char* co_http_scan_char_resolve(const char*, size_t, char);
+
+static const co_http_scan_ops_st co_http_scan_ops_resolve =
+{
+    co_http_scan_crlf_resolve, co_http_scan_char_resolve
+};
+
+// every thread resolves to the same table, so a racing first use is benign
+static const co_http_scan_ops_st* co_http_scan_ops =
+    &co_http_scan_ops_resolve;
+
+static co_http_scan_level_t co_http_scan_level = CO_HTTP_SCAN_LEVEL_SCALAR;
+
+static const char*
+co_http_scan_crlf_resolve(
+    const char* data,
+    size_t length
+)
+{
+    co_http_scan_set_level(CO_HTTP_SCAN_LEVEL_AVX2);
+
+    return co_http_scan_ops->find_crlf(data, length);
+}
+
+static const char*
+co_http_scan_char_resolve(
+    const char* data,
+    size_t length,
+    char ch
+)
+{
+    co_http_scan_set_level(CO_HTTP_SCAN_LEVEL_AVX2);
+
+    return co_http_scan_ops->find_char(data, length, ch);
+}
+
+const char*
+co_http_scan_crlf(
+    const char* data,
+    size_t length
+)
+{
+    return co_http_scan_ops->find_crlf(data, length);
+}
+
+const char*
+co_http_scan_char(
+    const char* data,
+    size_t length,
+    char ch
+)
+{
+    return co_http_scan_ops->find_char(data, length, ch);
+}
+
+size_t
+co_http_scan_token(
+    const char* data,
+    size_t length
+)
+{
+    size_t pos = 0;
+
+    while ((pos < length) &&
+        ((co_http_scan_char_table[(uint8_t)data[pos]] &
+            CO_HTTP_SCAN_CHAR_TOKEN) != 0))
+    {
+        ++pos;
+    }
+
+    return pos;
+}
+
+void
+co_http_scan_trim_ows(
+    const char* data,
+    size_t* begin,
+    size_t* end
+)
+{
+    while (((*begin) < (*end)) &&
+        ((co_http_scan_char_table[(uint8_t)data[*begin]] &
+            CO_HTTP_SCAN_CHAR_OWS) != 0))
+    {
+        ++(*begin);
+    }
+
+    while (((*end) > (*begin)) &&
+        ((co_http_scan_char_table[(uint8_t)data[(*end) - 1]] &
+            CO_HTTP_SCAN_CHAR_OWS) != 0))
+    {
+        --(*end);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+co_http_scan_level_t
+co_http_scan_get_supported_level(
+    void
+)
+{
+#ifdef CO_HTTP_SCAN_AVX2
+    if (co_http_scan_cpu_has_avx2())
+    {
+        return CO_HTTP_SCAN_LEVEL_AVX2;
+    }
+#endif
+#ifdef CO_HTTP_SCAN_SSE2
+    return CO_HTTP_SCAN_LEVEL_SSE2;
+#else
+    return CO_HTTP_SCAN_LEVEL_SCALAR;
+#endif
+}
+
+co_http_scan_level_t
+co_http_scan_set_level(
+    co_http_scan_level_t level
+)
+{
+    const co_http_scan_level_t supported_level =
+        co_http_scan_get_supported_level();
+
+    if (level > supported_level)
+    {
+        level = supported_level;
+    }
+
+    co_http_scan_level = level;
+    co_http_scan_ops = &co_http_scan_ops_table[level];
+
+    return level;
+}
+
+co_http_scan_level_t
+co_http_scan_get_level(
+    void
+)
+{
+    if (co_http_scan_ops == &co_http_scan_ops_resolve)
+    {
+        return co_http_scan_set_level(CO_HTTP_SCAN_LEVEL_AVX2);
+    }
+
+    return co_http_scan_level;
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
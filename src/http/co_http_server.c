@@ -10,6 +10,8 @@
 #include <coldforce/http/co_http_config.h>
 #include <coldforce/http/co_http_log.h>
 
+#include <inttypes.h>
+
 //---------------------------------------------------------------------------//
 // http server
 //---------------------------------------------------------------------------//
@@ -40,6 +42,219 @@ co_http_server_on_request(
     client->request = NULL;
 }
 
+static void
+co_http_server_destroy_response_slot(
+    co_http_response_slot_t* slot
+)
+{
+    co_http_request_destroy(slot->request);
+    co_byte_array_destroy(slot->data);
+    co_mem_free(slot);
+}
+
+static co_http_response_slot_t*
+co_http_server_add_response_slot(
+    co_http_client_t* client,
+    co_http_request_t* request
+)
+{
+    if (client->response_queue == NULL)
+    {
+        co_list_ctx_st list_ctx = { 0 };
+        list_ctx.destroy_value =
+            (co_item_destroy_fn)co_http_server_destroy_response_slot;
+
+        client->response_queue = co_list_create(&list_ctx);
+
+        if (client->response_queue == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    co_http_response_slot_t* slot =
+        (co_http_response_slot_t*)co_mem_alloc(
+            sizeof(co_http_response_slot_t));
+
+    if (slot == NULL)
+    {
+        return NULL;
+    }
+
+    slot->request = request;
+    slot->data = NULL;
+    slot->ready = false;
+
+    co_list_add_tail(client->response_queue, slot);
+
+    return slot;
+}
+
+static bool
+co_http_server_is_response_queue_full(
+    const co_http_client_t* client
+)
+{
+    return (co_http_get_deferred_response_count(client) >=
+        co_http_config_get_max_deferred_response_count());
+}
+
+// responses are held while the content of a file is read out,
+// and the pipelined requests wait for it to end
+static bool
+co_http_server_is_receive_held(
+    const co_http_client_t* client
+)
+{
+    return (client->file_sender != NULL) ||
+        co_http_server_is_response_queue_full(client);
+}
+
+static bool
+co_http_server_send_ready_responses(
+    co_http_client_t* client
+)
+{
+    const bool full = co_http_server_is_response_queue_full(client);
+
+    bool result = true;
+
+    while (result && (client->file_sender == NULL) &&
+        (co_http_get_deferred_response_count(client) > 0))
+    {
+        co_http_response_slot_t* slot =
+            (co_http_response_slot_t*)co_list_get_head(
+                client->response_queue)->value;
+
+        if (!slot->ready)
+        {
+            break;
+        }
+
+        // no data if it was sent as soon as it was given
+        if (slot->data != NULL)
+        {
+            result = co_http_connection_send_data(&client->conn,
+                co_byte_array_get_ptr(slot->data, 0),
+                co_byte_array_get_count(slot->data));
+        }
+
+        co_list_remove_head(client->response_queue);
+    }
+
+    // parsing stopped at the limit, the requests left in the buffer
+    // or in the socket are taken up again
+    if (result && full && !co_http_server_is_response_queue_full(client))
+    {
+        co_tcp_client_continue_receive(client->conn.tcp_client);
+    }
+
+    return result;
+}
+
+// a lost response leaves a gap, the ones behind it would answer
+// the wrong requests. the slot no longer blocks the queue and the
+// connection is closed
+static bool
+co_http_server_fail_response(
+    co_http_client_t* client,
+    co_http_response_slot_t* slot
+)
+{
+    co_byte_array_destroy(slot->data);
+    slot->data = NULL;
+    slot->ready = true;
+
+    co_tcp_half_close(client->conn.tcp_client,
+        co_http_config_get_max_receive_wait_time());
+
+    return false;
+}
+
+static bool
+co_http_server_hold_response(
+    co_http_client_t* client,
+    co_http_response_slot_t* slot,
+    const co_buffer_st* buffers,
+    size_t buffer_count
+)
+{
+    // the slot is at the head, the response goes out now
+    if ((client->file_sender == NULL) &&
+        (co_list_get_head(client->response_queue)->value == slot))
+    {
+        if (!co_http_connection_send_vec(
+            &client->conn, buffers, buffer_count))
+        {
+            return co_http_server_fail_response(client, slot);
+        }
+
+        slot->ready = true;
+
+        return co_http_server_send_ready_responses(client);
+    }
+
+    slot->data = co_byte_array_create();
+
+    if (slot->data == NULL)
+    {
+        return co_http_server_fail_response(client, slot);
+    }
+
+    for (size_t index = 0; index < buffer_count; ++index)
+    {
+        co_byte_array_add(
+            slot->data, buffers[index].ptr, buffers[index].size);
+    }
+
+    slot->ready = true;
+
+    return true;
+}
+
+static bool
+co_http_server_hold_serialized_response(
+    co_http_client_t* client,
+    co_http_response_slot_t* slot,
+    const co_http_response_t* response
+)
+{
+    co_http_log_debug_response_header(
+        &client->conn.tcp_client->sock.local.net_addr, "-->",
+        &client->conn.tcp_client->sock.remote.net_addr,
+        response, "http send deferred response");
+
+    co_byte_array_t* buffer = co_byte_array_create();
+
+    if (buffer == NULL)
+    {
+        return co_http_server_fail_response(client, slot);
+    }
+
+    co_http_response_serialize_header(response, buffer);
+
+    co_buffer_st buffers[2];
+    size_t buffer_count = 0;
+
+    buffers[buffer_count].ptr = co_byte_array_get_ptr(buffer, 0);
+    buffers[buffer_count].size = co_byte_array_get_count(buffer);
+    ++buffer_count;
+
+    if ((response->message.data.ptr != NULL) &&
+        (response->message.data.size > 0))
+    {
+        buffers[buffer_count] = response->message.data;
+        ++buffer_count;
+    }
+
+    bool result = co_http_server_hold_response(
+        client, slot, buffers, buffer_count);
+
+    co_byte_array_destroy(buffer);
+
+    return result;
+}
+
 void
 co_http_server_on_tcp_receive_ready(
     co_thread_t* thread,
@@ -49,23 +264,64 @@ co_http_server_on_tcp_receive_ready(
     co_http_client_t* client =
         (co_http_client_t*)tcp_client->sock.sub_class;
 
-    ssize_t receive_result =
-        client->conn.module.receive_all(
-            client->conn.tcp_client,
-            client->conn.receive_data.ptr);
+    if ((client->request != NULL) &&
+        !co_http_header_materialize(&client->request->message.header))
+    {
+        co_http_server_on_request(
+            thread, client, CO_HTTP_ERROR_OUT_OF_MEMORY);
+
+        return;
+    }
 
-    if (receive_result <= 0)
+    // the pipelined requests wait in the buffer, and in the socket,
+    // until responses are sent
+    if ((client->request == NULL) &&
+        co_http_server_is_receive_held(client))
     {
         return;
     }
 
+    ssize_t receive_result = 0;
+
+    // a paused body can leave a whole read unconsumed, it is handled
+    // before reading more so that the buffer stays bounded
+    if ((client->request != NULL) &&
+        co_http_message_is_header_complete(&client->request->message) &&
+        ((co_byte_array_get_count(client->conn.receive_data.ptr) -
+            client->conn.receive_data.index) >=
+                co_http_config_get_max_receive_read_size()))
+    {
+        co_tcp_client_continue_receive(client->conn.tcp_client);
+    }
+    else
+    {
+        receive_result = co_http_connection_receive(&client->conn);
+    }
+
     size_t data_size =
         co_byte_array_get_count(client->conn.receive_data.ptr);
 
+    // data left over by a pause is handled even without a new read
+    if ((receive_result <= 0) &&
+        (data_size <= client->conn.receive_data.index))
+    {
+        return;
+    }
+
     while (data_size > client->conn.receive_data.index)
     {
+        if (co_tcp_is_receive_paused(tcp_client))
+        {
+            return;
+        }
+
         if (client->request == NULL)
         {
+            if (co_http_server_is_receive_held(client))
+            {
+                return;
+            }
+
             client->request = co_http_request_create(NULL, NULL);
 
             if (client->request == NULL)
@@ -76,6 +332,14 @@ co_http_server_on_tcp_receive_ready(
                 return;
             }
 
+            // fields stay in the receive buffer while the request is
+            // handled, they are copied only if it outlives this read
+            client->request->message.parser.zero_copy = true;
+        }
+
+        if (!co_http_message_is_header_complete(&client->request->message))
+        {
+            // keeps the partial request, parsing resumes on the next read
             int result = co_http_request_deserialize(
                 client->request,
                 client->conn.receive_data.ptr,
@@ -99,6 +363,7 @@ co_http_server_on_tcp_receive_ready(
                 }
 
                 if ((!client->content_receiver.chunked) &&
+                    (client->callbacks.on_receive_data == NULL) &&
                     (client->content_receiver.size >
                         co_http_config_get_max_receive_content_size()))
                 {
@@ -110,9 +375,6 @@ co_http_server_on_tcp_receive_ready(
             }
             else if (result == CO_HTTP_PARSE_MORE_DATA)
             {
-                co_http_request_destroy(client->request);
-                client->request = NULL;
-
                 return;
             }
             else
@@ -163,8 +425,283 @@ co_http_server_on_tcp_receive_ready(
         }
     }
 
-    client->conn.receive_data.index = 0;
-    co_byte_array_clear(client->conn.receive_data.ptr);
+    co_http_connection_clear_receive_data(&client->conn);
+}
+
+static void
+co_http_server_end_send_file(
+    co_http_client_t* client
+)
+{
+    client->conn.tcp_client->callbacks.on_send_buffer_low = NULL;
+
+    co_http_file_sender_destroy(client->file_sender);
+    client->file_sender = NULL;
+}
+
+static bool
+co_http_server_send_file_block(
+    co_http_client_t* client
+)
+{
+    co_http_file_sender_t* sender = client->file_sender;
+    co_tcp_client_t* tcp_client = client->conn.tcp_client;
+
+    // fills the send buffer up to its high watermark,
+    // the rest follows when it drains to the low watermark
+    while ((sender->remaining_size > 0) && !tcp_client->send_buffer.high)
+    {
+        size_t block_size = CO_HTTP_FILE_READ_BLOCK_SIZE;
+
+        if (sender->remaining_size < block_size)
+        {
+            block_size = (size_t)sender->remaining_size;
+        }
+
+        ssize_t read_size = co_http_file_read(
+            &sender->file, sender->offset, sender->buffer, block_size);
+
+        if (read_size <= 0)
+        {
+            co_http_log_error(
+                &tcp_client->sock.local.net_addr, "-->",
+                &tcp_client->sock.remote.net_addr,
+                "http send file: read failed");
+
+            return false;
+        }
+
+        if (!client->conn.module.send(
+            tcp_client, sender->buffer, (size_t)read_size))
+        {
+            return false;
+        }
+
+        sender->offset += (uint64_t)read_size;
+        sender->remaining_size -= (uint64_t)read_size;
+    }
+
+    if (sender->remaining_size == 0)
+    {
+        co_http_server_end_send_file(client);
+    }
+
+    return true;
+}
+
+static void
+co_http_server_on_tcp_send_buffer_low(
+    co_thread_t* thread,
+    co_tcp_client_t* tcp_client,
+    size_t buffered_size
+)
+{
+    (void)thread;
+    (void)buffered_size;
+
+    co_http_client_t* client =
+        (co_http_client_t*)tcp_client->sock.sub_class;
+
+    if (client->file_sender == NULL)
+    {
+        return;
+    }
+
+    if (!co_http_server_send_file_block(client))
+    {
+        // the content length can no longer be met
+
+        co_http_server_end_send_file(client);
+
+        co_tcp_half_close(tcp_client,
+            co_http_config_get_max_receive_wait_time());
+
+        return;
+    }
+
+    if (client->file_sender == NULL)
+    {
+        // the held responses and requests follow the file
+
+        if (co_http_server_send_ready_responses(client))
+        {
+            co_tcp_client_continue_receive(tcp_client);
+        }
+    }
+}
+
+static bool
+co_http_server_send_file_content(
+    co_http_client_t* client,
+    co_http_file_st* file,
+    uint64_t offset,
+    uint64_t size
+)
+{
+    co_tcp_client_t* tcp_client = client->conn.tcp_client;
+
+#ifndef CO_OS_WIN
+    if ((tcp_client->sock.tls == NULL) &&
+        !co_tcp_is_sending_file(tcp_client))
+    {
+        const int fd = file->fd;
+
+        // the tcp client owns the file from here
+        file->fd = -1;
+
+        return co_tcp_send_file(tcp_client, fd, offset, (size_t)size);
+    }
+#endif
+
+    client->file_sender = co_http_file_sender_create(file, offset, size);
+
+    if (client->file_sender == NULL)
+    {
+        return false;
+    }
+
+    tcp_client->callbacks.on_send_buffer_low =
+        co_http_server_on_tcp_send_buffer_low;
+
+    if (!co_http_server_send_file_block(client))
+    {
+        co_http_server_end_send_file(client);
+
+        return false;
+    }
+
+    return true;
+}
+
+static bool
+co_http_server_send_file(
+    co_http_client_t* client,
+    const co_http_request_t* request,
+    co_http_response_t* response,
+    const char* path,
+    bool range_enabled
+)
+{
+    if ((client->file_sender != NULL) ||
+        (co_http_get_deferred_response_count(client) > 0))
+    {
+        return false;
+    }
+
+    co_http_file_st file;
+
+    if (!co_http_file_open(path, &file))
+    {
+        return false;
+    }
+
+    co_http_header_t* header = &response->message.header;
+
+    char value[128];
+
+    co_http_format_date(file.modified_time, value);
+
+    co_http_header_set_field(header, CO_HTTP_HEADER_ETAG, file.etag);
+    co_http_header_set_field(header, CO_HTTP_HEADER_LAST_MODIFIED, value);
+
+    if (range_enabled)
+    {
+        co_http_header_set_field(
+            header, CO_HTTP_HEADER_ACCEPT_RANGES, "bytes");
+    }
+
+    uint64_t offset = 0;
+    uint64_t size = file.size;
+
+    const char* method = (request != NULL) ?
+        co_http_request_get_method(request) : "";
+    const bool head = (strcmp(method, "HEAD") == 0);
+
+    // the conditions only turn a GET or HEAD into 304
+    // (RFC 9110 13.1.2, 13.1.3), other methods get the file
+    if ((request != NULL) &&
+        (head || (strcmp(method, "GET") == 0)) &&
+        co_http_file_is_not_modified(&file, request))
+    {
+        co_http_response_set_status_code(response, 304);
+        co_http_response_set_reason_phrase(response, "Not Modified");
+
+        size = 0;
+    }
+    else
+    {
+        int range = CO_HTTP_FILE_RANGE_NONE;
+
+        if (range_enabled && (request != NULL))
+        {
+            range = co_http_file_get_range(&file, request, &offset, &size);
+        }
+
+        if (range == CO_HTTP_FILE_RANGE_SATISFIABLE)
+        {
+            co_http_response_set_status_code(response, 206);
+            co_http_response_set_reason_phrase(response, "Partial Content");
+
+            snprintf(value, sizeof(value),
+                "bytes %" PRIu64 "-%" PRIu64 "/%" PRIu64,
+                offset, offset + size - 1, file.size);
+
+            co_http_header_set_field(
+                header, CO_HTTP_HEADER_CONTENT_RANGE, value);
+        }
+        else if (range == CO_HTTP_FILE_RANGE_UNSATISFIABLE)
+        {
+            co_http_response_set_status_code(response, 416);
+            co_http_response_set_reason_phrase(
+                response, "Range Not Satisfiable");
+
+            snprintf(value, sizeof(value), "bytes */%" PRIu64, file.size);
+
+            co_http_header_set_field(
+                header, CO_HTTP_HEADER_CONTENT_RANGE, value);
+
+            size = 0;
+        }
+
+        snprintf(value, sizeof(value), "%" PRIu64, size);
+
+        co_http_header_set_field(
+            header, CO_HTTP_HEADER_CONTENT_LENGTH, value);
+    }
+
+    if (head)
+    {
+        size = 0;
+    }
+
+    co_http_log_debug(NULL, NULL, NULL,
+        "http send file %s (%" PRIu64 " bytes)", path, size);
+
+    bool result = co_http_connection_send_response(&client->conn, response);
+
+    if (result && (size > 0))
+    {
+        result = co_http_server_send_file_content(
+            client, &file, offset, size);
+
+        if (!result)
+        {
+            // the header is out, a response sent after it
+            // would land in the middle of the content
+
+            co_tcp_half_close(client->conn.tcp_client,
+                co_http_config_get_max_receive_wait_time());
+        }
+    }
+
+    co_http_file_close(&file);
+
+    if (result)
+    {
+        co_http_response_destroy(response);
+    }
+
+    return result;
 }
 
 void
@@ -181,6 +718,46 @@ co_http_server_on_http_connection_close(
     }
 }
 
+bool
+co_http_server_is_holding_response(
+    const co_http_client_t* client
+)
+{
+    return (co_http_get_deferred_response_count(client) > 0);
+}
+
+// the content sent after a held response goes with it
+bool
+co_http_server_add_held_data(
+    co_http_client_t* client,
+    const void* data,
+    size_t data_size
+)
+{
+    co_http_response_slot_t* slot =
+        (co_http_response_slot_t*)co_list_get_tail(
+            client->response_queue)->value;
+
+    if (!slot->ready)
+    {
+        return false;
+    }
+
+    if (slot->data == NULL)
+    {
+        slot->data = co_byte_array_create();
+
+        if (slot->data == NULL)
+        {
+            return false;
+        }
+    }
+
+    co_byte_array_add(slot->data, data, data_size);
+
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 // public
 //---------------------------------------------------------------------------//
@@ -191,8 +768,21 @@ co_http_send_response(
     co_http_response_t* response
 )
 {
-    bool result = co_http_connection_send_response(
-        &client->conn, response);
+    bool result;
+
+    if ((client->file_sender != NULL) ||
+        (co_http_get_deferred_response_count(client) > 0))
+    {
+        co_http_response_slot_t* slot =
+            co_http_server_add_response_slot(client, NULL);
+
+        result = (slot != NULL) &&
+            co_http_server_hold_serialized_response(client, slot, response);
+    }
+    else
+    {
+        result = co_http_connection_send_response(&client->conn, response);
+    }
 
     if (result)
     {
@@ -202,15 +792,178 @@ co_http_send_response(
     return result;
 }
 
+bool
+co_http_send_response_template(
+    co_http_client_t* client,
+    const co_http_response_template_t* response_template,
+    const void* data,
+    size_t data_size
+)
+{
+    if ((client->file_sender != NULL) ||
+        (co_http_get_deferred_response_count(client) > 0))
+    {
+        co_http_response_slot_t* slot =
+            co_http_server_add_response_slot(client, NULL);
+
+        return (slot != NULL) &&
+            co_http_send_deferred_response_template(client, slot,
+                response_template, data, data_size);
+    }
+
+    return co_http_connection_send_response_template(
+        &client->conn, response_template, data, data_size);
+}
+
+co_http_response_slot_t*
+co_http_defer_response(
+    co_http_client_t* client
+)
+{
+    co_http_request_t* request = client->request;
+
+    // the request outlives the receive buffer its fields view
+    if ((request == NULL) ||
+        !co_http_header_materialize(&request->message.header))
+    {
+        return NULL;
+    }
+
+    co_http_response_slot_t* slot =
+        co_http_server_add_response_slot(client, request);
+
+    if (slot != NULL)
+    {
+        client->request = NULL;
+    }
+
+    return slot;
+}
+
+const co_http_request_t*
+co_http_response_slot_get_request(
+    const co_http_response_slot_t* slot
+)
+{
+    return slot->request;
+}
+
+bool
+co_http_send_deferred_response(
+    co_http_client_t* client,
+    co_http_response_slot_t* slot,
+    co_http_response_t* response
+)
+{
+    if (!co_http_server_hold_serialized_response(client, slot, response))
+    {
+        return false;
+    }
+
+    co_http_response_destroy(response);
+
+    return true;
+}
+
+bool
+co_http_send_deferred_response_template(
+    co_http_client_t* client,
+    co_http_response_slot_t* slot,
+    const co_http_response_template_t* response_template,
+    const void* data,
+    size_t data_size
+)
+{
+    co_http_log_debug(
+        &client->conn.tcp_client->sock.local.net_addr, "-->",
+        &client->conn.tcp_client->sock.remote.net_addr,
+        "http send deferred response template (%zd bytes)", data_size);
+
+    char tail[CO_HTTP_RESPONSE_TEMPLATE_TAIL_SIZE];
+
+    co_buffer_st buffers[3];
+    size_t buffer_count = 0;
+
+    buffers[buffer_count].ptr =
+        co_byte_array_get_ptr(response_template->header_block, 0);
+    buffers[buffer_count].size =
+        co_byte_array_get_count(response_template->header_block);
+    ++buffer_count;
+
+    buffers[buffer_count].ptr = tail;
+    buffers[buffer_count].size =
+        co_http_response_template_serialize_tail(
+            response_template, data_size, tail);
+    ++buffer_count;
+
+    if ((data != NULL) && (data_size > 0))
+    {
+        buffers[buffer_count].ptr = (void*)data;
+        buffers[buffer_count].size = data_size;
+        ++buffer_count;
+    }
+
+    return co_http_server_hold_response(
+        client, slot, buffers, buffer_count);
+}
+
+size_t
+co_http_get_deferred_response_count(
+    const co_http_client_t* client
+)
+{
+    return (client->response_queue != NULL) ?
+        co_list_get_count(client->response_queue) : 0;
+}
+
+bool
+co_http_send_file_response(
+    co_http_client_t* client,
+    const co_http_request_t* request,
+    co_http_response_t* response,
+    const char* path
+)
+{
+    return co_http_server_send_file(
+        client, request, response, path, false);
+}
+
+bool
+co_http_send_file_range_response(
+    co_http_client_t* client,
+    const co_http_request_t* request,
+    co_http_response_t* response,
+    const char* path
+)
+{
+    return co_http_server_send_file(
+        client, request, response, path, true);
+}
+
+bool
+co_http_is_sending_file(
+    const co_http_client_t* client
+)
+{
+    return (client->file_sender != NULL);
+}
+
 bool
 co_http_start_chunked_response(
     co_http_client_t* client,
     co_http_response_t* response
 )
 {
+    // the chunks would pass the held back responses or the file
+    if ((client->file_sender != NULL) ||
+        (co_http_get_deferred_response_count(client) > 0))
+    {
+        return false;
+    }
+
     const char* transfer_encoding =
-        co_http_header_get_field(&response->message.header,
-            CO_HTTP_HEADER_TRANSFER_ENCODING);
+        co_http_header_get_field_by_id(&response->message.header,
+            CO_HTTP_HEADER_ID_TRANSFER_ENCODING);
 
     if (transfer_encoding == NULL)
     {
@@ -255,32 +1008,32 @@ co_http_send_chunked_data(
     size_t data_length
 )
 {
-    co_byte_array_t* buffer = co_byte_array_create();
-
     char chunk_size[64];
     sprintf(chunk_size, "%x"CO_HTTP_CRLF, (unsigned int)data_length);
 
-    co_byte_array_add_string(buffer, chunk_size);
+    co_buffer_st buffers[3];
+    size_t buffer_count = 0;
+
+    buffers[buffer_count].ptr = chunk_size;
+    buffers[buffer_count].size = strlen(chunk_size);
+    ++buffer_count;
 
     if (data_length > 0)
     {
-        co_byte_array_add(buffer, data, data_length);
+        buffers[buffer_count].ptr = (void*)data;
+        buffers[buffer_count].size = data_length;
+        ++buffer_count;
     }
 
-    co_byte_array_add_string(buffer, CO_HTTP_CRLF);
+    buffers[buffer_count].ptr = (void*)CO_HTTP_CRLF;
+    buffers[buffer_count].size = strlen(CO_HTTP_CRLF);
+    ++buffer_count;
 
     co_http_log_debug(NULL, NULL, NULL,
         "http send chunked data %zd", data_length);
 
-    bool result =
-        co_http_connection_send_data(
-            &client->conn,
-            co_byte_array_get_ptr(buffer, 0),
-            co_byte_array_get_count(buffer));
-
-    co_byte_array_destroy(buffer);
-
-    return result;
+    return co_http_connection_send_vec(
+        &client->conn, buffers, buffer_count);
 }
 
 bool
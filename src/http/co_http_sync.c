@@ -84,6 +84,9 @@ co_http_thread_on_receive_finish(
     (void)request;
     (void)error_code;
 
+    // outlives the receive buffer of the connection
+    co_http_header_materialize(&response->message.header);
+
     client->response = NULL;
     self->response = response;
 
@@ -29,6 +29,7 @@ co_tcp_upgrade_to_http_connection(
         conn->module.close = co_tcp_close;
         conn->module.connect = co_tcp_connect_start;
         conn->module.send = co_tls_tcp_send;
+        conn->module.send_vec = co_tls_tcp_send_vec;
         conn->module.receive_all = co_tls_tcp_receive_all;
     }
     else
@@ -37,6 +38,7 @@ co_tcp_upgrade_to_http_connection(
         conn->module.close = co_tcp_close;
         conn->module.connect = co_tcp_connect_start;
         conn->module.send = co_tcp_send;
+        conn->module.send_vec = co_tcp_send_vec;
         conn->module.receive_all = co_tcp_receive_all;
     }
 
@@ -49,6 +49,7 @@ co_http2_client_setup(
     client->callbacks.on_window_update = NULL;
     client->callbacks.on_close_stream = NULL;
     client->callbacks.on_ping = NULL;
+    client->callbacks.on_send_complete = NULL;
 
     co_map_ctx_st map_ctx = { 0 };
     map_ctx.destroy_value =
@@ -56,6 +57,14 @@ co_http2_client_setup(
 
     client->stream_map = co_map_create(&map_ctx);
 
+    client->send_waiting_streams = co_list_create(NULL);
+    client->max_send_data_pool_size =
+        CO_HTTP2_DEFAULT_MAX_SEND_DATA_POOL_SIZE;
+
+    client->send_buffer = co_byte_array_create();
+    client->cork_count = 0;
+    client->send_pass = 0;
+
     client->last_stream_id = 0;
     client->new_stream_id = 0;
 
@@ -91,10 +100,10 @@ co_http2_client_setup(
 
     co_http2_hpack_dynamic_table_setup(
         &client->local_dynamic_table,
-        client->local_settings.max_header_list_size);
+        client->local_settings.header_table_size);
     co_http2_hpack_dynamic_table_setup(
         &client->remote_dynamic_table,
-        client->remote_settings.max_header_list_size);
+        client->remote_settings.header_table_size);
 
     client->system_stream =
         co_http2_stream_create(0, client, NULL, NULL, NULL);
@@ -116,6 +125,12 @@ co_http2_client_cleanup(
         co_map_destroy(client->stream_map);
         client->stream_map = NULL;
 
+        co_list_destroy(client->send_waiting_streams);
+        client->send_waiting_streams = NULL;
+
+        co_byte_array_destroy(client->send_buffer);
+        client->send_buffer = NULL;
+
         co_http2_hpack_dynamic_table_cleanup(&client->local_dynamic_table);
         co_http2_hpack_dynamic_table_cleanup(&client->remote_dynamic_table);
     }
@@ -217,8 +232,17 @@ co_http2_client_on_close(
     int error_code
 )
 {
+    // the frames coalesced while receiving, such as the responses and
+    // acks before a GOAWAY, go out before the socket is closed
+    if (co_tcp_is_open(client->conn.tcp_client))
+    {
+        co_http2_client_flush(client);
+    }
+
     client->conn.module.close(client->conn.tcp_client);
 
+    co_byte_array_clear(client->send_buffer);
+
     if (client->callbacks.on_close != NULL)
     {
         client->callbacks.on_close(
@@ -227,6 +251,45 @@ co_http2_client_on_close(
     }
 }
 
+// the change of the initial window applies to the open streams
+// (RFC 9113 6.9.2)
+static bool
+co_http2_client_apply_initial_window_size(
+    co_http2_client_t* client,
+    uint32_t old_initial_window_size
+)
+{
+    if (client->remote_settings.initial_window_size >
+        CO_HTTP2_SETTING_MAX_WINDOW_SIZE)
+    {
+        return false;
+    }
+
+    const int64_t delta =
+        (int64_t)client->remote_settings.initial_window_size -
+        (int64_t)old_initial_window_size;
+
+    co_map_iterator_t it;
+    co_map_iterator_init(client->stream_map, &it);
+
+    while (co_map_iterator_has_next(&it))
+    {
+        co_http2_stream_t* stream =
+            (co_http2_stream_t*)it.item->data.value;
+        co_map_iterator_get_next(&it);
+
+        stream->remote_window_size += delta;
+
+        if (stream->remote_window_size >
+            (int64_t)CO_HTTP2_SETTING_MAX_WINDOW_SIZE)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 co_http2_client_on_receive_system_frame(
     co_http2_client_t* client,
@@ -252,6 +315,9 @@ co_http2_client_on_receive_system_frame(
             return;
         }
 
+        const uint32_t initial_window_size =
+            client->remote_settings.initial_window_size;
+
         for (size_t index = 0;
             index < frame->payload.settings.param_count;
             ++index)
@@ -262,12 +328,36 @@ co_http2_client_on_receive_system_frame(
                 frame->payload.settings.params[index].value);
         }
 
+        // the encoder may use any size up to the one of the peer
+        // decoder (RFC 7541 4.2), a larger one is not worth keeping
+        co_http2_hpack_dynamic_table_set_max_size(
+            &client->remote_dynamic_table,
+            co_min(client->remote_settings.header_table_size,
+                (uint32_t)CO_HTTP2_HPACK_MAX_ENCODER_TABLE_SIZE));
+
         co_http2_frame_t* ack_frame =
             co_http2_create_settings_frame(false, true, NULL, 0);
 
         co_http2_stream_send_frame(
             client->system_stream, ack_frame);
 
+        if (client->remote_settings.initial_window_size !=
+            initial_window_size)
+        {
+            if (!co_http2_client_apply_initial_window_size(
+                client, initial_window_size))
+            {
+                co_http2_close(
+                    client, CO_HTTP2_STREAM_ERROR_FLOW_CONTROL_ERROR);
+                co_http2_client_on_close(
+                    client, CO_HTTP2_STREAM_ERROR_FLOW_CONTROL_ERROR);
+
+                break;
+            }
+
+            co_http2_client_send_pending_data(client);
+        }
+
         break;
     }
     case CO_HTTP2_FRAME_TYPE_PING:
@@ -318,6 +408,8 @@ co_http2_client_on_receive_system_frame(
         client->system_stream->remote_window_size +=
             frame->payload.window_update.window_size_increment;
 
+        co_http2_client_send_pending_data(client);
+
         if (client->callbacks.on_window_update != NULL)
         {
             client->callbacks.on_window_update(
@@ -334,6 +426,144 @@ co_http2_client_on_receive_system_frame(
     }
 }
 
+static bool
+co_http2_client_is_sendable_stream(
+    const co_http2_stream_t* stream
+)
+{
+    // a lone END_STREAM needs no window
+    return ((co_http2_stream_get_pending_data_size(stream) == 0) ||
+        (co_http2_stream_get_sendable_data_size(stream) > 0));
+}
+
+static int
+co_http2_client_compare_stream_priority(
+    const co_http2_stream_t* stream1,
+    const co_http2_stream_t* stream2
+)
+{
+    if (stream1->priority.urgency != stream2->priority.urgency)
+    {
+        return (stream1->priority.urgency < stream2->priority.urgency) ? -1 : 1;
+    }
+
+    // non-incremental streams go one at a time in stream id order,
+    // ahead of the incremental ones sharing by weight
+
+    if (stream1->priority.incremental != stream2->priority.incremental)
+    {
+        return stream1->priority.incremental ? 1 : -1;
+    }
+
+    if (stream1->priority.incremental &&
+        (stream1->priority.pass != stream2->priority.pass))
+    {
+        return (stream1->priority.pass < stream2->priority.pass) ? -1 : 1;
+    }
+
+    if (stream1->id != stream2->id)
+    {
+        return (stream1->id < stream2->id) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+co_http2_stream_t*
+co_http2_client_select_send_stream(
+    co_http2_client_t* client
+)
+{
+    co_http2_stream_t* selected = NULL;
+    co_http2_stream_t* selected_dependent = NULL;
+
+    co_list_iterator_t* it =
+        co_list_get_head_iterator(client->send_waiting_streams);
+
+    while (it != NULL)
+    {
+        co_http2_stream_t* stream = (co_http2_stream_t*)
+            co_list_get_next(client->send_waiting_streams, &it)->value;
+
+        if (!co_http2_client_is_sendable_stream(stream))
+        {
+            continue;
+        }
+
+        // a dependent stream waits while its parent can still send
+
+        const co_http2_stream_t* parent = NULL;
+
+        if (stream->priority.stream_dependency != 0)
+        {
+            parent = co_http2_get_stream(
+                client, stream->priority.stream_dependency);
+        }
+
+        if ((parent != NULL) &&
+            parent->send_data_pool.waiting &&
+            co_http2_client_is_sendable_stream(parent))
+        {
+            if ((selected_dependent == NULL) ||
+                (co_http2_client_compare_stream_priority(
+                    stream, selected_dependent) < 0))
+            {
+                selected_dependent = stream;
+            }
+        }
+        else if ((selected == NULL) ||
+            (co_http2_client_compare_stream_priority(
+                stream, selected) < 0))
+        {
+            selected = stream;
+        }
+    }
+
+    // only dependents left (a dependency cycle)
+    return (selected != NULL) ? selected : selected_dependent;
+}
+
+void
+co_http2_client_send_pending_data(
+    co_http2_client_t* client
+)
+{
+    const uint32_t max_frame_size =
+        client->remote_settings.max_frame_size;
+
+    co_http2_cork(client);
+
+    for (;;)
+    {
+        co_http2_stream_t* stream =
+            co_http2_client_select_send_stream(client);
+
+        if (stream == NULL)
+        {
+            break;
+        }
+
+        // stride scheduling: a stream's next turn comes later
+        // the lower its weight
+        client->send_pass = stream->priority.pass;
+
+        stream->priority.pass +=
+            ((uint64_t)max_frame_size * CO_HTTP2_STREAM_MAX_WEIGHT) /
+                stream->priority.weight;
+
+        // the stream may be gone after on_send_complete
+        co_http2_stream_send_pending_data(stream, max_frame_size);
+
+        // and the client closed or destroyed
+        if (client->conn.tcp_client == NULL)
+        {
+            return;
+        }
+    }
+
+    co_http2_uncork(client);
+}
+
 bool
 co_http2_client_on_push_promise(
     co_http2_client_t* client,
@@ -435,21 +665,13 @@ co_http2_client_on_http_connection_close(
     co_http2_client_on_close(client, 0);
 }
 
-void
-co_http2_client_on_tcp_receive_ready(
-    co_thread_t* thread,
-    co_tcp_client_t* tcp_client
+static void
+co_http2_client_receive_frames(
+    co_http2_client_t* client
 )
 {
-    (void)thread;
-
-    co_http2_client_t* client =
-        (co_http2_client_t*)tcp_client->sock.sub_class;
-
     ssize_t receive_result =
-        client->conn.module.receive_all(
-            client->conn.tcp_client,
-            client->conn.receive_data.ptr);
+        co_http_connection_receive(&client->conn);
 
     if (receive_result <= 0)
     {
@@ -536,8 +758,101 @@ co_http2_client_on_tcp_receive_ready(
         }
     }
 
-    client->conn.receive_data.index = 0;
-    co_byte_array_clear(client->conn.receive_data.ptr);
+    co_http_connection_clear_receive_data(&client->conn);
+}
+
+void
+co_http2_client_on_tcp_receive_ready(
+    co_thread_t* thread,
+    co_tcp_client_t* tcp_client
+)
+{
+    (void)thread;
+
+    co_http2_client_t* client =
+        (co_http2_client_t*)tcp_client->sock.sub_class;
+
+    // replies and responses made while handling the received
+    // frames go out together
+
+    co_http2_cork(client);
+    co_http2_client_receive_frames(client);
+    co_http2_uncork(client);
+}
+
+bool
+co_http2_client_send_buffers(
+    co_http2_client_t* client,
+    const co_buffer_st* buffers,
+    size_t buffer_count
+)
+{
+    co_assert(buffer_count < CO_HTTP2_FRAME_MAX_VEC_COUNT);
+
+    size_t data_size = 0;
+
+    for (size_t index = 0; index < buffer_count; ++index)
+    {
+        data_size += buffers[index].size;
+    }
+
+    if ((client->cork_count > 0) &&
+        (data_size < CO_HTTP2_SEND_BUFFER_FLUSH_SIZE))
+    {
+        for (size_t index = 0; index < buffer_count; ++index)
+        {
+            co_byte_array_add(client->send_buffer,
+                buffers[index].ptr, buffers[index].size);
+        }
+
+        if (co_byte_array_get_count(client->send_buffer) <
+            CO_HTTP2_SEND_BUFFER_FLUSH_SIZE)
+        {
+            return true;
+        }
+
+        return co_http2_client_flush(client);
+    }
+
+    // large payloads are sent in place behind the buffered bytes
+
+    co_buffer_st send_buffers[CO_HTTP2_FRAME_MAX_VEC_COUNT];
+
+    send_buffers[0].ptr = co_byte_array_get_ptr(client->send_buffer, 0);
+    send_buffers[0].size = co_byte_array_get_count(client->send_buffer);
+
+    for (size_t index = 0; index < buffer_count; ++index)
+    {
+        send_buffers[index + 1] = buffers[index];
+    }
+
+    bool result = co_http_connection_send_vec(
+        &client->conn, send_buffers, buffer_count + 1);
+
+    co_byte_array_clear(client->send_buffer);
+
+    return result;
+}
+
+bool
+co_http2_client_flush(
+    co_http2_client_t* client
+)
+{
+    const size_t data_size =
+        co_byte_array_get_count(client->send_buffer);
+
+    if (data_size == 0)
+    {
+        return true;
+    }
+
+    bool result = co_http_connection_send_data(&client->conn,
+        co_byte_array_get_ptr(client->send_buffer, 0), data_size);
+
+    co_byte_array_clear(client->send_buffer);
+
+    return result;
 }
 
 bool
@@ -714,6 +1029,8 @@ co_http2_close(
                 client->system_stream, goaway_frame);
         }
 
+        co_http2_client_flush(client);
+
         client->conn.module.close(client->conn.tcp_client);
     }
 }
@@ -826,6 +1143,8 @@ co_http2_send_initial_settings(
         co_http2_create_settings_frame(
             false, false, params, param_count);
 
+    co_http2_cork(client);
+
     bool result = co_http2_stream_send_frame(
         client->system_stream, frame);
 
@@ -838,6 +1157,11 @@ co_http2_send_initial_settings(
             client->local_settings.initial_window_size);
     }
 
+    if (!co_http2_uncork(client))
+    {
+        result = false;
+    }
+
     return result;
 }
 
@@ -878,6 +1202,42 @@ co_http2_update_settings(
     }
 }
 
+void
+co_http2_cork(
+    co_http2_client_t* client
+)
+{
+    ++client->cork_count;
+}
+
+bool
+co_http2_uncork(
+    co_http2_client_t* client
+)
+{
+    if (client->cork_count > 0)
+    {
+        --client->cork_count;
+    }
+
+    if ((client->cork_count > 0) ||
+        (client->conn.tcp_client == NULL))
+    {
+        return true;
+    }
+
+    return co_http2_client_flush(client);
+}
+
+void
+co_http2_set_max_send_data_pool_size(
+    co_http2_client_t* client,
+    size_t max_size
+)
+{
+    client->max_send_data_pool_size = max_size;
+}
+
 const co_http2_settings_st*
 co_http2_get_local_settings(
     const co_http2_client_t* client
@@ -1,5 +1,6 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_string.h>
+#include <coldforce/core/co_mem_pool.h>
 
 #include <coldforce/net/co_byte_order.h>
 
@@ -30,15 +31,12 @@ typedef struct
 
 } co_http2_frame_length_t;
 
-void
-co_http2_frame_serialize(
+static void
+co_http2_frame_serialize_header(
     const co_http2_frame_t* frame,
     co_byte_array_t* buffer
 )
 {
-    uint16_t u16;
-    uint32_t u32;
-
     co_http2_frame_length_t length24;
     length24.value.u32 =
         co_byte_order_32_host_to_network(frame->header.length);
@@ -47,8 +45,74 @@ co_http2_frame_serialize(
     co_byte_array_add(buffer, &frame->header.type, sizeof(uint8_t));
     co_byte_array_add(buffer, &frame->header.flags, sizeof(uint8_t));
 
-    u32 = co_byte_order_32_host_to_network(frame->header.stream_id);
+    uint32_t u32 =
+        co_byte_order_32_host_to_network(frame->header.stream_id);
     co_byte_array_add(buffer, &u32, sizeof(uint32_t));
+}
+
+size_t
+co_http2_frame_serialize_vec(
+    const co_http2_frame_t* frame,
+    co_byte_array_t* buffer,
+    co_buffer_st* buffers
+)
+{
+    if (frame->header.type != CO_HTTP2_FRAME_TYPE_DATA)
+    {
+        co_http2_frame_serialize(frame, buffer);
+
+        buffers[0].ptr = co_byte_array_get_ptr(buffer, 0);
+        buffers[0].size = co_byte_array_get_count(buffer);
+
+        return 1;
+    }
+
+    // DATA payload is referenced in place, only the prefix is copied
+
+    co_http2_frame_serialize_header(frame, buffer);
+
+    const bool padded =
+        ((frame->header.flags & CO_HTTP2_FRAME_FLAG_PADDED) != 0);
+
+    if (padded)
+    {
+        co_byte_array_add(buffer,
+            &frame->payload.data.pad_length, sizeof(uint8_t));
+    }
+
+    size_t buffer_count = 0;
+
+    buffers[buffer_count].ptr = co_byte_array_get_ptr(buffer, 0);
+    buffers[buffer_count].size = co_byte_array_get_count(buffer);
+    ++buffer_count;
+
+    if (frame->payload.data.data_length > 0)
+    {
+        buffers[buffer_count].ptr = frame->payload.data.data;
+        buffers[buffer_count].size = frame->payload.data.data_length;
+        ++buffer_count;
+    }
+
+    if (padded && (frame->payload.data.pad_length > 0))
+    {
+        buffers[buffer_count].ptr = frame->payload.data.padding;
+        buffers[buffer_count].size = frame->payload.data.pad_length;
+        ++buffer_count;
+    }
+
+    return buffer_count;
+}
+
+void
+co_http2_frame_serialize(
+    const co_http2_frame_t* frame,
+    co_byte_array_t* buffer
+)
+{
+    uint16_t u16;
+    uint32_t u32;
+
+    co_http2_frame_serialize_header(frame, buffer);
 
     switch (frame->header.type)
     {
@@ -538,7 +602,7 @@ co_http2_frame_create(
 )
 {
     co_http2_frame_t* frame =
-        (co_http2_frame_t*)co_mem_alloc(sizeof(co_http2_frame_t));
+        (co_http2_frame_t*)co_mem_pool_alloc(sizeof(co_http2_frame_t));
 
     if (frame != NULL)
     {
@@ -621,7 +685,7 @@ co_http2_frame_destroy(
             }
         }
 
-        co_mem_free(frame);
+        co_mem_pool_free(frame);
     }
 }
 
@@ -354,6 +354,109 @@ co_http2_header_get_weight(
     return header->weight;
 }
 
+void
+co_http2_header_set_priority(
+    co_http2_header_t* header,
+    uint8_t urgency,
+    bool incremental
+)
+{
+    char value[16];
+
+    sprintf(value, "u=%u%s",
+        (unsigned int)co_min(urgency, CO_HTTP2_PRIORITY_MAX_URGENCY),
+        (incremental ? ", i" : ""));
+
+    co_http2_header_set_field(header, CO_HTTP2_HEADER_PRIORITY, value);
+}
+
+bool
+co_http2_header_get_priority(
+    const co_http2_header_t* header,
+    uint8_t* urgency,
+    bool* incremental
+)
+{
+    *urgency = CO_HTTP2_PRIORITY_DEFAULT_URGENCY;
+    *incremental = false;
+
+    const char* value =
+        co_http2_header_get_field(header, CO_HTTP2_HEADER_PRIORITY);
+
+    if (value == NULL)
+    {
+        return false;
+    }
+
+    // structured field dictionary: "u=1, i", parameters are ignored
+
+    const char* ptr = value;
+
+    while (*ptr != '\0')
+    {
+        while ((*ptr == ' ') || (*ptr == '\t') || (*ptr == ','))
+        {
+            ++ptr;
+        }
+
+        const char* key = ptr;
+
+        while ((*ptr != '\0') && (*ptr != '=') && (*ptr != ',') &&
+            (*ptr != ';') && (*ptr != ' '))
+        {
+            ++ptr;
+        }
+
+        const size_t key_length = ptr - key;
+
+        const char* item = NULL;
+        size_t item_length = 0;
+
+        if (*ptr == '=')
+        {
+            item = ++ptr;
+
+            while ((*ptr != '\0') && (*ptr != ',') &&
+                (*ptr != ';') && (*ptr != ' '))
+            {
+                ++ptr;
+            }
+
+            item_length = ptr - item;
+        }
+
+        while ((*ptr != '\0') && (*ptr != ','))
+        {
+            ++ptr;
+        }
+
+        if ((key_length != 1) || ((key[0] != 'u') && (key[0] != 'i')))
+        {
+            continue;
+        }
+
+        if (key[0] == 'u')
+        {
+            if ((item_length == 1) &&
+                (item[0] >= '0') &&
+                (item[0] <= ('0' + CO_HTTP2_PRIORITY_MAX_URGENCY)))
+            {
+                *urgency = (uint8_t)(item[0] - '0');
+            }
+        }
+        else if (item == NULL)
+        {
+            *incremental = true;
+        }
+        else if ((item_length == 2) && (item[0] == '?'))
+        {
+            *incremental = (item[1] == '1');
+        }
+    }
+
+    return true;
+}
+
 size_t
 co_http2_header_get_field_count(
     const co_http2_header_t* header
@@ -180,7 +180,6 @@ co_http2_hpack_serialize_4bits_int(
 }
 #endif
 
-#if 0
 static void
 co_http2_hpack_serialize_5bits_int(
     bool flag,
@@ -193,7 +192,6 @@ co_http2_hpack_serialize_5bits_int(
         (flag ? CO_HTTP2_FLAG_5_BITS : 0),
         value, buffer);
 }
-#endif
 
 static void
 co_http2_hpack_serialize_6bits_int(
@@ -256,66 +254,314 @@ co_http2_hpack_serialize_string(
     }
 }
 
+// a decoded name or value: owned, or a view into a table
+typedef struct
+{
+    const char* ptr;
+    size_t length;
+    char* owned;
+
+} co_http2_hpack_string_st;
+
+static void
+co_http2_hpack_string_set_view(
+    co_http2_hpack_string_st* str,
+    const char* ptr,
+    size_t length
+)
+{
+    str->ptr = ptr;
+    str->length = length;
+    str->owned = NULL;
+}
+
+static void
+co_http2_hpack_string_release(
+    co_http2_hpack_string_st* str
+)
+{
+    co_string_destroy(str->owned);
+    co_http2_hpack_string_set_view(str, NULL, 0);
+}
+
+// the only copy a field makes on its way into a header
+static char*
+co_http2_hpack_string_detach(
+    co_http2_hpack_string_st* str
+)
+{
+    char* result = str->owned;
+
+    if (result == NULL)
+    {
+        result = co_string_duplicate_n(str->ptr, str->length);
+    }
+
+    co_http2_hpack_string_set_view(str, NULL, 0);
+
+    return result;
+}
+
 static bool
 co_http2_hpack_deserialize_string(
     const uint8_t* data,
     size_t data_size,
-    char** str,
-    uint32_t* str_length,
+    co_http2_hpack_string_st* str,
     size_t* index
 )
 {
+    uint32_t str_length = 0;
+
     if (!co_http2_hpack_deserialize_int(
-        CO_HTTP2_MAX_7_BITS, data, data_size, str_length, index))
+        CO_HTTP2_MAX_7_BITS, data, data_size, &str_length, index))
     {
         return false;
     }
 
-    if ((data_size - (*index)) < (size_t)(*str_length))
+    if ((data_size - (*index)) < (size_t)str_length)
     {
         return false;
     }
 
-    if ((*data) & CO_HTTP2_FLAG_7_BITS)
+    if (((*data) & CO_HTTP2_FLAG_7_BITS) && (str_length > 0))
     {
-        size_t dest_length = 0;
+        char* decoded = NULL;
+        size_t decoded_length = 0;
 
         if (!co_http2_huffman_decode(
-            &data[(*index)], (*str_length),
-            str, &dest_length))
+            &data[(*index)], str_length,
+            &decoded, &decoded_length))
         {
             return false;
         }
 
-        (*index) += (*str_length);
-
-        (*str_length) = (uint32_t)dest_length;
+        str->ptr = decoded;
+        str->length = decoded_length;
+        str->owned = decoded;
     }
     else
     {
-        (*str) = co_string_duplicate_n(
-            (const char*)&data[(*index)],
-            (*str_length));
+        // a raw literal is viewed in place
+        co_http2_hpack_string_set_view(str,
+            (const char*)&data[(*index)], str_length);
+    }
+
+    (*index) += str_length;
+
+    return true;
+}
+
+#define CO_HTTP2_HPACK_ENTRY_OVERHEAD      32
+#define CO_HTTP2_HPACK_MIN_ENTRY_CAPACITY   16
+#define CO_HTTP2_HPACK_MIN_ARENA_CAPACITY   1024
+#define CO_HTTP2_HPACK_MIN_BUCKET_CAPACITY  32
+
+#define CO_HTTP2_HPACK_HASH_OFFSET_BASIS    2166136261u
+#define CO_HTTP2_HPACK_HASH_PRIME           16777619u
+
+// FNV-1a. names are hashed without case as they are compared
+static uint32_t
+co_http2_hpack_hash_name(
+    const char* name,
+    size_t name_length
+)
+{
+    uint32_t hash = CO_HTTP2_HPACK_HASH_OFFSET_BASIS;
+
+    for (size_t index = 0; index < name_length; ++index)
+    {
+        uint8_t c = (uint8_t)name[index];
+
+        if ((c >= 'A') && (c <= 'Z'))
+        {
+            c += ('a' - 'A');
+        }
+
+        hash = (hash ^ c) * CO_HTTP2_HPACK_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+static uint32_t
+co_http2_hpack_hash_value(
+    uint32_t name_hash,
+    const char* value,
+    size_t value_length
+)
+{
+    uint32_t hash = (name_hash ^ 0xff) * CO_HTTP2_HPACK_HASH_PRIME;
+
+    for (size_t index = 0; index < value_length; ++index)
+    {
+        hash = (hash ^ (uint8_t)value[index]) * CO_HTTP2_HPACK_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+static uint32_t
+co_http2_hpack_dynamic_table_entry_size(
+    const co_http2_hpack_dynamic_table_entry_st* entry
+)
+{
+    return entry->name_length + entry->value_length +
+        CO_HTTP2_HPACK_ENTRY_OVERHEAD;
+}
+
+// position 0 is the newest entry
+static const co_http2_hpack_dynamic_table_entry_st*
+co_http2_hpack_dynamic_table_get_entry(
+    const co_http2_hpack_dynamic_table_t* dynamic_table,
+    uint32_t position
+)
+{
+    return &dynamic_table->entries[
+        (dynamic_table->entry_head +
+            dynamic_table->entry_count - 1 - position) &
+        (dynamic_table->entry_capacity - 1)];
+}
+
+static co_http2_hpack_dynamic_table_entry_st*
+co_http2_hpack_dynamic_table_get_mutable_entry(
+    co_http2_hpack_dynamic_table_t* dynamic_table,
+    uint32_t position
+)
+{
+    return (co_http2_hpack_dynamic_table_entry_st*)
+        co_http2_hpack_dynamic_table_get_entry(dynamic_table, position);
+}
+
+static void
+co_http2_hpack_dynamic_table_clear(
+    co_http2_hpack_dynamic_table_t* dynamic_table
+)
+{
+    dynamic_table->total_size = 0;
+    dynamic_table->entry_head = 0;
+    dynamic_table->entry_count = 0;
+    dynamic_table->arena_start = 0;
+    dynamic_table->arena_end = 0;
+}
+
+static void
+co_http2_hpack_dynamic_table_evict(
+    co_http2_hpack_dynamic_table_t* dynamic_table,
+    uint32_t max_size
+)
+{
+    // only the positions move, the bytes stay until overwritten
+
+    while (dynamic_table->total_size > max_size)
+    {
+        dynamic_table->total_size -=
+            co_http2_hpack_dynamic_table_entry_size(
+                &dynamic_table->entries[dynamic_table->entry_head]);
+
+        dynamic_table->entry_head =
+            (dynamic_table->entry_head + 1) &
+                (dynamic_table->entry_capacity - 1);
+        --dynamic_table->entry_count;
+
+        if (dynamic_table->entry_count == 0)
+        {
+            co_http2_hpack_dynamic_table_clear(dynamic_table);
+
+            return;
+        }
+
+        dynamic_table->arena_start =
+            dynamic_table->entries[dynamic_table->entry_head].offset;
+    }
+}
 
-        (*index) += (*str_length);
+static bool
+co_http2_hpack_dynamic_table_reserve_entry(
+    co_http2_hpack_dynamic_table_t* dynamic_table
+)
+{
+    if (dynamic_table->entry_count < dynamic_table->entry_capacity)
+    {
+        return true;
     }
 
-    if ((*str) == NULL)
+    const uint32_t capacity = co_max(
+        dynamic_table->entry_capacity * 2,
+        CO_HTTP2_HPACK_MIN_ENTRY_CAPACITY);
+
+    co_http2_hpack_dynamic_table_entry_st* entries =
+        (co_http2_hpack_dynamic_table_entry_st*)co_mem_alloc(
+            sizeof(co_http2_hpack_dynamic_table_entry_st) * capacity);
+
+    if (entries == NULL)
     {
         return false;
     }
 
+    // unwrap the ring, the oldest goes to 0
+
+    for (uint32_t index = 0; index < dynamic_table->entry_count; ++index)
+    {
+        entries[index] = dynamic_table->entries[
+            (dynamic_table->entry_head + index) &
+                (dynamic_table->entry_capacity - 1)];
+    }
+
+    co_mem_free(dynamic_table->entries);
+
+    dynamic_table->entries = entries;
+    dynamic_table->entry_capacity = capacity;
+    dynamic_table->entry_head = 0;
+
     return true;
 }
 
-static void
-co_http2_hpack_dynamic_table_item_destroy(
-    co_http2_hpack_dynamic_table_item_t* item
+static bool
+co_http2_hpack_dynamic_table_move_arena(
+    co_http2_hpack_dynamic_table_t* dynamic_table,
+    uint32_t size,
+    uint8_t** old_arena
 )
 {
-    co_string_destroy(item->name);
-    co_string_destroy(item->value);
-    co_mem_free(item);
+    // the live bytes go to the front of a new arena with room for
+    // size more. the caller frees the old arena
+
+    const uint32_t live_size =
+        dynamic_table->arena_end - dynamic_table->arena_start;
+
+    const uint32_t capacity = co_max(
+        co_max((live_size + size) * 2, dynamic_table->arena_capacity),
+        (uint32_t)CO_HTTP2_HPACK_MIN_ARENA_CAPACITY);
+
+    uint8_t* arena = (uint8_t*)co_mem_alloc(capacity);
+
+    if (arena == NULL)
+    {
+        return false;
+    }
+
+    if (live_size > 0)
+    {
+        memcpy(arena,
+            &dynamic_table->arena[dynamic_table->arena_start], live_size);
+    }
+
+    for (uint32_t index = 0; index < dynamic_table->entry_count; ++index)
+    {
+        dynamic_table->entries[
+            (dynamic_table->entry_head + index) &
+                (dynamic_table->entry_capacity - 1)].offset -=
+                    dynamic_table->arena_start;
+    }
+
+    (*old_arena) = dynamic_table->arena;
+
+    dynamic_table->arena = arena;
+    dynamic_table->arena_capacity = capacity;
+    dynamic_table->arena_start = 0;
+    dynamic_table->arena_end = live_size;
+
+    return true;
 }
 
 void
@@ -327,11 +573,24 @@ co_http2_hpack_dynamic_table_setup(
     dynamic_table->max_size = max_size;
     dynamic_table->total_size = 0;
 
-    co_list_ctx_st ctx = { 0 };
-    ctx.destroy_value =
-        (co_item_destroy_fn)co_http2_hpack_dynamic_table_item_destroy;
+    dynamic_table->entries = NULL;
+    dynamic_table->entry_capacity = 0;
+    dynamic_table->entry_head = 0;
+    dynamic_table->entry_count = 0;
+
+    dynamic_table->arena = NULL;
+    dynamic_table->arena_capacity = 0;
+    dynamic_table->arena_start = 0;
+    dynamic_table->arena_end = 0;
+
+    dynamic_table->insert_count = 0;
+
+    dynamic_table->name_buckets = NULL;
+    dynamic_table->field_buckets = NULL;
+    dynamic_table->bucket_capacity = 0;
 
-    dynamic_table->items = co_list_create(&ctx);
+    dynamic_table->size_update_pending = false;
+    dynamic_table->min_pending_size = max_size;
 }
 
 void
@@ -341,8 +600,21 @@ co_http2_hpack_dynamic_table_cleanup(
 {
     if (dynamic_table != NULL)
     {
-        co_list_destroy(dynamic_table->items);
-        dynamic_table->items = NULL;
+        co_mem_free(dynamic_table->entries);
+        dynamic_table->entries = NULL;
+
+        co_mem_free(dynamic_table->arena);
+        dynamic_table->arena = NULL;
+
+        co_mem_free(dynamic_table->name_buckets);
+        dynamic_table->name_buckets = NULL;
+        dynamic_table->field_buckets = NULL;
+
+        dynamic_table->entry_capacity = 0;
+        dynamic_table->arena_capacity = 0;
+        dynamic_table->bucket_capacity = 0;
+
+        co_http2_hpack_dynamic_table_clear(dynamic_table);
     }
 }
 
@@ -354,161 +626,325 @@ co_http2_hpack_dynamic_table_resize(
 {
     dynamic_table->max_size = max_size;
 
-    if (dynamic_table->max_size == 0)
+    co_http2_hpack_dynamic_table_evict(
+        dynamic_table, dynamic_table->max_size);
+}
+
+void
+co_http2_hpack_dynamic_table_set_max_size(
+    co_http2_hpack_dynamic_table_t* dynamic_table,
+    uint32_t max_size
+)
+{
+    if (max_size == dynamic_table->max_size)
     {
-        dynamic_table->total_size = 0;
+        return;
+    }
 
-        co_list_clear(dynamic_table->items);
+    // the decoder applies the update before the next header block,
+    // so evicting now keeps both tables the same
 
-        return;
+    if (!dynamic_table->size_update_pending ||
+        (max_size < dynamic_table->min_pending_size))
+    {
+        dynamic_table->min_pending_size =
+            co_min(max_size, dynamic_table->max_size);
     }
 
-    while (dynamic_table->total_size > dynamic_table->max_size)
+    dynamic_table->size_update_pending = true;
+
+    co_http2_hpack_dynamic_table_resize(dynamic_table, max_size);
+}
+
+static void
+co_http2_hpack_dynamic_table_link_entry(
+    co_http2_hpack_dynamic_table_t* dynamic_table,
+    uint32_t position
+)
+{
+    co_http2_hpack_dynamic_table_entry_st* entry =
+        co_http2_hpack_dynamic_table_get_mutable_entry(
+            dynamic_table, position);
+
+    const char* name = (const char*)&dynamic_table->arena[entry->offset];
+    const char* value = name + entry->name_length + 1;
+
+    const uint32_t name_hash =
+        co_http2_hpack_hash_name(name, entry->name_length);
+    const uint32_t field_hash =
+        co_http2_hpack_hash_value(name_hash, value, entry->value_length);
+
+    const uint32_t mask = dynamic_table->bucket_capacity - 1;
+    const uint32_t number = dynamic_table->insert_count - position;
+
+    entry->name_next = dynamic_table->name_buckets[name_hash & mask];
+    dynamic_table->name_buckets[name_hash & mask] = number;
+
+    entry->field_next = dynamic_table->field_buckets[field_hash & mask];
+    dynamic_table->field_buckets[field_hash & mask] = number;
+}
+
+static bool
+co_http2_hpack_dynamic_table_build_index(
+    co_http2_hpack_dynamic_table_t* dynamic_table
+)
+{
+    const uint32_t capacity = co_max(
+        dynamic_table->entry_capacity * 2,
+        (uint32_t)CO_HTTP2_HPACK_MIN_BUCKET_CAPACITY);
+
+    uint32_t* buckets =
+        (uint32_t*)co_mem_alloc(sizeof(uint32_t) * capacity * 2);
+
+    if (buckets == NULL)
     {
-        co_list_data_st* data =
-            co_list_get_tail(dynamic_table->items);
-        co_http2_hpack_dynamic_table_item_t* old_item =
-            (co_http2_hpack_dynamic_table_item_t*)data->value;
+        return false;
+    }
+
+    memset(buckets, 0x00, sizeof(uint32_t) * capacity * 2);
 
-        dynamic_table->total_size -= old_item->size;
+    co_mem_free(dynamic_table->name_buckets);
 
-        co_list_remove_tail(dynamic_table->items);
+    dynamic_table->name_buckets = buckets;
+    dynamic_table->field_buckets = buckets + capacity;
+    dynamic_table->bucket_capacity = capacity;
+
+    // oldest first, so that the newest ends up at the bucket head
+
+    for (uint32_t position = dynamic_table->entry_count;
+        position > 0;
+        --position)
+    {
+        co_http2_hpack_dynamic_table_link_entry(
+            dynamic_table, position - 1);
     }
+
+    return true;
 }
 
 static bool
 co_http2_hpack_dynamic_table_add_item(
     co_http2_hpack_dynamic_table_t* dynamic_table,
     const char* name,
-    const char* value
+    size_t name_length,
+    const char* value,
+    size_t value_length
 )
 {
-    co_http2_hpack_dynamic_table_item_t* item =
-        (co_http2_hpack_dynamic_table_item_t*)co_mem_alloc(
-            sizeof(co_http2_hpack_dynamic_table_item_t));
+    const size_t size =
+        name_length + value_length + CO_HTTP2_HPACK_ENTRY_OVERHEAD;
 
-    if (item == NULL)
+    // an entry larger than the table empties it (RFC 7541 4.4)
+    if (size > dynamic_table->max_size)
     {
-        return false;
-    }
+        co_http2_hpack_dynamic_table_clear(dynamic_table);
 
-    size_t name_length = strlen(name);
-    item->name = co_string_duplicate_n(name, name_length);
+        return true;
+    }
 
-    if (item->name == NULL)
+    if (!co_http2_hpack_dynamic_table_reserve_entry(dynamic_table))
     {
-        co_mem_free(item);
-
         return false;
     }
 
-    size_t value_length = strlen(value);
-    item->value = co_string_duplicate_n(value, value_length);
+    // name and value may point into the arena (an indexed name),
+    // so they are copied before anything is evicted or freed
 
-    if (item->value == NULL)
-    {
-        co_string_destroy(item->name);
-        co_mem_free(item);
+    const uint32_t data_size = (uint32_t)(name_length + value_length + 2);
+    uint8_t* old_arena = NULL;
 
+    if (((dynamic_table->arena_capacity - dynamic_table->arena_end) <
+            data_size) &&
+        !co_http2_hpack_dynamic_table_move_arena(
+            dynamic_table, data_size, &old_arena))
+    {
         return false;
     }
 
-    item->size = (uint32_t)(name_length + value_length + 32);
+    co_http2_hpack_dynamic_table_entry_st entry;
+    entry.offset = dynamic_table->arena_end;
+    entry.name_length = (uint32_t)name_length;
+    entry.value_length = (uint32_t)value_length;
+    entry.name_next = 0;
+    entry.field_next = 0;
 
-    if (!co_list_add_head(dynamic_table->items, item))
-    {
-        co_string_destroy(item->name);
-        co_string_destroy(item->value);
-        co_mem_free(item);
+    uint8_t* data = &dynamic_table->arena[entry.offset];
 
-        return false;
-    }
+    memmove(data, name, name_length);
+    data[name_length] = '\0';
+    data += name_length + 1;
+
+    memmove(data, value, value_length);
+    data[value_length] = '\0';
+
+    co_mem_free(old_arena);
 
-    dynamic_table->total_size += item->size;
+    dynamic_table->arena_end += data_size;
 
-    while (dynamic_table->total_size > dynamic_table->max_size)
+    co_http2_hpack_dynamic_table_evict(
+        dynamic_table, (uint32_t)(dynamic_table->max_size - size));
+
+    if (dynamic_table->entry_count == 0)
     {
-        co_list_data_st* data =
-            co_list_get_tail(dynamic_table->items);
-        co_http2_hpack_dynamic_table_item_t* old_item =
-            (co_http2_hpack_dynamic_table_item_t*)data->value;
+        // everything was evicted, the arena restarted at 0
+        memmove(dynamic_table->arena,
+            &dynamic_table->arena[entry.offset], data_size);
+
+        entry.offset = 0;
+        dynamic_table->arena_end = data_size;
+    }
 
-        dynamic_table->total_size -= old_item->size;
+    dynamic_table->entries[
+        (dynamic_table->entry_head + dynamic_table->entry_count) &
+            (dynamic_table->entry_capacity - 1)] = entry;
+    ++dynamic_table->entry_count;
+    ++dynamic_table->insert_count;
 
-        co_list_remove_tail(dynamic_table->items);
+    dynamic_table->total_size += (uint32_t)size;
+
+    if (dynamic_table->bucket_capacity > 0)
+    {
+        // keep the load at most a half. if the rebuild fails the
+        // old buckets are still valid, only more crowded
+        if ((dynamic_table->entry_capacity * 2 <=
+                dynamic_table->bucket_capacity) ||
+            !co_http2_hpack_dynamic_table_build_index(dynamic_table))
+        {
+            co_http2_hpack_dynamic_table_link_entry(dynamic_table, 0);
+        }
     }
 
     return true;
 }
 
 static bool
-co_http2_hpack_dynamic_table_find_item(
+co_http2_hpack_dynamic_table_find_in_chain(
     const co_http2_hpack_dynamic_table_t* dynamic_table,
+    uint32_t number,
+    bool match_value,
     const char* name,
+    size_t name_length,
     const char* value,
+    size_t value_length,
     uint32_t* header_index
 )
 {
-    (*header_index) = 62;
-
-    const co_list_iterator_t* it =
-        co_list_get_const_head_iterator(dynamic_table->items);
+    // the chain runs from the newest to the oldest. the first
+    // evicted entry ends it, the rest are older still
 
-    while (it != NULL)
+    for (uint32_t count = 0;
+        (number != 0) && (count < dynamic_table->entry_count);
+        ++count)
     {
-        const co_list_data_st* data =
-            co_list_get_const_next(dynamic_table->items, &it);
-        const co_http2_hpack_dynamic_table_item_t* item =
-            (const co_http2_hpack_dynamic_table_item_t*)data->value;
+        const uint32_t position = dynamic_table->insert_count - number;
+
+        if (position >= dynamic_table->entry_count)
+        {
+            break;
+        }
+
+        const co_http2_hpack_dynamic_table_entry_st* entry =
+            co_http2_hpack_dynamic_table_get_entry(
+                dynamic_table, position);
 
-        if ((co_string_case_compare(item->name, name) == 0) &&
-            (co_string_case_compare(item->value, value) == 0))
+        const char* entry_name =
+            (const char*)&dynamic_table->arena[entry->offset];
+        const char* entry_value = entry_name + entry->name_length + 1;
+
+        if ((entry->name_length == name_length) &&
+            (co_string_case_compare(entry_name, name) == 0) &&
+            (!match_value ||
+                ((entry->value_length == value_length) &&
+                (memcmp(entry_value, value, value_length) == 0))))
         {
+            (*header_index) = 62 + position;
+
             return true;
         }
 
-        ++(*header_index);
+        number = match_value ? entry->field_next : entry->name_next;
     }
 
     return false;
 }
 
 static bool
-co_http2_hpack_dynamic_table_find_item_by_index(
+co_http2_hpack_dynamic_table_find_item(
     const co_http2_hpack_dynamic_table_t* dynamic_table,
-    uint32_t header_index,
-    char** name,
-    char** value
+    const char* name,
+    const char* value,
+    uint32_t* header_index,
+    bool* value_matched
 )
 {
-    header_index -= 61;
+    if (dynamic_table->bucket_capacity == 0)
+    {
+        return false;
+    }
 
-    const co_list_iterator_t* it =
-        co_list_get_const_head_iterator(dynamic_table->items);
-    const co_list_data_st* data = NULL;
+    const size_t name_length = strlen(name);
+    const size_t value_length = strlen(value);
+
+    const uint32_t name_hash =
+        co_http2_hpack_hash_name(name, name_length);
+    const uint32_t field_hash =
+        co_http2_hpack_hash_value(name_hash, value, value_length);
+
+    const uint32_t mask = dynamic_table->bucket_capacity - 1;
 
-    while ((it != NULL) && (header_index != 0))
+    if (co_http2_hpack_dynamic_table_find_in_chain(dynamic_table,
+        dynamic_table->field_buckets[field_hash & mask], true,
+        name, name_length, value, value_length, header_index))
     {
-        data = co_list_get_const_next(dynamic_table->items, &it);
-        --header_index;
+        (*value_matched) = true;
+
+        return true;
+    }
+
+    if (co_http2_hpack_dynamic_table_find_in_chain(dynamic_table,
+        dynamic_table->name_buckets[name_hash & mask], false,
+        name, name_length, value, value_length, header_index))
+    {
+        (*value_matched) = false;
+
+        return true;
     }
 
-    if ((data == NULL) || (header_index != 0))
+    return false;
+}
+
+// name and value are views into the arena, valid until the next add
+static bool
+co_http2_hpack_dynamic_table_find_item_by_index(
+    const co_http2_hpack_dynamic_table_t* dynamic_table,
+    uint32_t header_index,
+    co_http2_hpack_string_st* name,
+    co_http2_hpack_string_st* value
+)
+{
+    if ((header_index < 62) ||
+        ((header_index - 62) >= dynamic_table->entry_count))
     {
         return false;
     }
 
-    const co_http2_hpack_dynamic_table_item_t* item =
-        (const co_http2_hpack_dynamic_table_item_t*)data->value;
+    const co_http2_hpack_dynamic_table_entry_st* entry =
+        co_http2_hpack_dynamic_table_get_entry(
+            dynamic_table, header_index - 62);
+
+    const char* entry_name =
+        (const char*)&dynamic_table->arena[entry->offset];
 
     if (name != NULL)
     {
-        (*name) = co_string_duplicate(item->name);
+        co_http2_hpack_string_set_view(
+            name, entry_name, entry->name_length);
     }
 
     if (value != NULL)
     {
-        (*value) = co_string_duplicate(item->value);
+        co_http2_hpack_string_set_view(value,
+            entry_name + entry->name_length + 1, entry->value_length);
     }
 
     return true;
@@ -517,22 +953,44 @@ co_http2_hpack_dynamic_table_find_item_by_index(
 static bool
 co_http2_hpack_static_table_find_item(
     const char* name,
-    uint32_t* header_index
+    const char* value,
+    uint32_t* header_index,
+    bool* value_matched
 )
 {
     size_t hash = co_string_hash(name) % 285;
     uint32_t index = hpack_static_hash_name_table[hash];
 
-    if ((index != 0xff) &&
+    if ((index == 0xff) ||
         (co_string_case_compare(
-            hpack_static_name_table[index], name) == 0))
+            hpack_static_name_table[index], name) != 0))
     {
-        (*header_index) = (index + 1);
+        return false;
+    }
 
-        return true;
+    (*header_index) = (index + 1);
+    (*value_matched) = false;
+
+    // the entries of a name are adjacent, the hash gives the first
+
+    for (; (index < 61) &&
+        (co_string_case_compare(
+            hpack_static_name_table[index], name) == 0);
+        ++index)
+    {
+        const char* static_value = (index < 16) ?
+            hpack_static_value_table[index] : NULL;
+
+        if (strcmp((static_value != NULL) ? static_value : "", value) == 0)
+        {
+            (*header_index) = (index + 1);
+            (*value_matched) = true;
+
+            break;
+        }
     }
 
-    return false;
+    return true;
 }
 
 static void
@@ -543,29 +1001,60 @@ co_http2_hpack_serialize_header_field(
     co_byte_array_t* buffer
 )
 {
-    uint32_t header_index = 0;
+    uint32_t static_index = 0;
+    bool static_value_matched = false;
 
-    if (co_http2_hpack_dynamic_table_find_item(
-        dynamic_table, name, value, &header_index))
+    const bool static_found = co_http2_hpack_static_table_find_item(
+        name, value, &static_index, &static_value_matched);
+
+    if (static_found && static_value_matched)
     {
-        co_http2_hpack_serialize_7bits_int(true, header_index, buffer);
+        co_http2_hpack_serialize_7bits_int(true, static_index, buffer);
+
+        return;
     }
-    else if (co_http2_hpack_static_table_find_item(name, &header_index))
+
+    if (dynamic_table->bucket_capacity == 0)
     {
-        co_http2_hpack_serialize_6bits_int(true, header_index, buffer);
-        co_http2_hpack_serialize_string(
-            true, value, (uint32_t)strlen(value), buffer);
-        co_http2_hpack_dynamic_table_add_item(dynamic_table, name, value);
+        // without an index the fields are only literals
+        co_http2_hpack_dynamic_table_build_index(dynamic_table);
+    }
+
+    uint32_t dynamic_index = 0;
+    bool dynamic_value_matched = false;
+
+    const bool dynamic_found = co_http2_hpack_dynamic_table_find_item(
+        dynamic_table, name, value, &dynamic_index, &dynamic_value_matched);
+
+    if (dynamic_found && dynamic_value_matched)
+    {
+        co_http2_hpack_serialize_7bits_int(true, dynamic_index, buffer);
+
+        return;
+    }
+
+    const size_t name_length = strlen(name);
+    const size_t value_length = strlen(value);
+
+    if (static_found)
+    {
+        co_http2_hpack_serialize_6bits_int(true, static_index, buffer);
+    }
+    else if (dynamic_found)
+    {
+        co_http2_hpack_serialize_6bits_int(true, dynamic_index, buffer);
     }
     else
     {
         co_http2_hpack_serialize_6bits_int(true, 0, buffer);
         co_http2_hpack_serialize_string(
-            true, name, (uint32_t)strlen(name), buffer);
-        co_http2_hpack_serialize_string(
-            true, value, (uint32_t)strlen(value), buffer);
-        co_http2_hpack_dynamic_table_add_item(dynamic_table, name, value);
+            true, name, (uint32_t)name_length, buffer);
     }
+
+    co_http2_hpack_serialize_string(
+        true, value, (uint32_t)value_length, buffer);
+    co_http2_hpack_dynamic_table_add_item(
+        dynamic_table, name, name_length, value, value_length);
 }
 
 void
@@ -575,21 +1064,29 @@ co_http2_hpack_serialize_header(
     co_byte_array_t* buffer
 )
 {
-    if (header->pseudo.method != NULL)
+    // a dynamic table size update starts the header block
+    // (RFC 7541 6.3)
+
+    if (dynamic_table->size_update_pending)
     {
-        if (co_string_case_compare(header->pseudo.method, "GET") == 0)
-        {
-            co_http2_hpack_serialize_7bits_int(true, 2, buffer);
-        }
-        else if (co_string_case_compare(header->pseudo.method, "POST") == 0)
+        if (dynamic_table->min_pending_size < dynamic_table->max_size)
         {
-            co_http2_hpack_serialize_7bits_int(true, 3, buffer);
-        }
-        else
-        {
-            co_http2_hpack_serialize_header_field(
-                ":method", header->pseudo.method, dynamic_table, buffer);
+            co_http2_hpack_serialize_5bits_int(
+                true, dynamic_table->min_pending_size, buffer);
         }
+
+        co_http2_hpack_serialize_5bits_int(
+            true, dynamic_table->max_size, buffer);
+
+        dynamic_table->size_update_pending = false;
+    }
+
+    // the common pseudo header values are in the static table
+
+    if (header->pseudo.method != NULL)
+    {
+        co_http2_hpack_serialize_header_field(
+            ":method", header->pseudo.method, dynamic_table, buffer);
     }
 
     if (header->pseudo.protocol != NULL)
@@ -600,38 +1097,16 @@ co_http2_hpack_serialize_header(
     
     if (header->pseudo.scheme != NULL)
     {
-        if (co_string_case_compare(header->pseudo.scheme, "http") == 0)
-        {
-            co_http2_hpack_serialize_7bits_int(true, 6, buffer);
-        }
-        else if (co_string_case_compare(header->pseudo.scheme, "https") == 0)
-        {
-            co_http2_hpack_serialize_7bits_int(true, 7, buffer);
-        }
-        else
-        {
-            co_http2_hpack_serialize_header_field(
-                ":scheme", header->pseudo.scheme, dynamic_table, buffer);
-        }
+        co_http2_hpack_serialize_header_field(
+            ":scheme", header->pseudo.scheme, dynamic_table, buffer);
     }
 
     if (header->pseudo.url != NULL)
     {
         if (header->pseudo.url->query == NULL)
         {
-            if (co_string_case_compare(header->pseudo.url->path, "/") == 0)
-            {
-                co_http2_hpack_serialize_7bits_int(true, 4, buffer);
-            }
-            else if (co_string_case_compare(header->pseudo.url->path, "/index.html") == 0)
-            {
-                co_http2_hpack_serialize_7bits_int(true, 5, buffer);
-            }
-            else
-            {
-                co_http2_hpack_serialize_header_field(
-                    ":path", header->pseudo.url->path, dynamic_table, buffer);
-            }
+            co_http2_hpack_serialize_header_field(
+                ":path", header->pseudo.url->path, dynamic_table, buffer);
         }
         else
         {
@@ -648,61 +1123,11 @@ co_http2_hpack_serialize_header(
 
     if (header->pseudo.status_code != 0)
     {
-        switch (header->pseudo.status_code)
-        {
-        case 200:
-        {
-            co_http2_hpack_serialize_7bits_int(true, 8, buffer);
-
-            break;
-        }
-        case 204:
-        {
-            co_http2_hpack_serialize_7bits_int(true, 9, buffer);
-
-            break;
-        }
-        case 206:
-        {
-            co_http2_hpack_serialize_7bits_int(true, 10, buffer);
-
-            break;
-        }
-        case 304:
-        {
-            co_http2_hpack_serialize_7bits_int(true, 11, buffer);
-
-            break;
-        }
-        case 400:
-        {
-            co_http2_hpack_serialize_7bits_int(true, 12, buffer);
-
-            break;
-        }
-        case 404:
-        {
-            co_http2_hpack_serialize_7bits_int(true, 13, buffer);
-
-            break;
-        }
-        case 500:
-        {
-            co_http2_hpack_serialize_7bits_int(true, 14, buffer);
+        char status_code_str[8];
+        sprintf(status_code_str, "%hu", header->pseudo.status_code);
 
-            break;
-        }
-        default:
-        {
-            char status_code_str[8];
-            sprintf(status_code_str, "%hu", header->pseudo.status_code);
-
-            co_http2_hpack_serialize_header_field(
-                ":status", status_code_str, dynamic_table, buffer);
-
-            break;
-        }
-        }
+        co_http2_hpack_serialize_header_field(
+            ":status", status_code_str, dynamic_table, buffer);
     }
 
     const co_list_iterator_t* it =
@@ -727,13 +1152,12 @@ co_http2_hpack_deserialize_header_field(
     size_t data_size,
     const co_http2_hpack_dynamic_table_t* dynamic_table,
     uint32_t* header_index,
-    char** name,
-    char** value,
+    co_http2_hpack_string_st* name,
+    co_http2_hpack_string_st* value,
     size_t* index
 )
 {
     size_t temp_index = 0;
-    uint32_t str_length = 0;
 
     (*index) = 0;
 
@@ -750,7 +1174,7 @@ co_http2_hpack_deserialize_header_field(
     if ((*header_index) == 0)
     {
         if (!co_http2_hpack_deserialize_string(
-            data, data_size, name, &str_length, &temp_index))
+            data, data_size, name, &temp_index))
         {
             return false;
         }
@@ -758,37 +1182,122 @@ co_http2_hpack_deserialize_header_field(
         (*index) += temp_index;
         data_size -= temp_index;
         data += temp_index;
+    }
+    else if ((*header_index) <= 61)
+    {
+        const char* static_name =
+            hpack_static_name_table[(*header_index) - 1];
 
-        if (!co_http2_hpack_deserialize_string(
-            data, data_size, value, &str_length, &temp_index))
+        co_http2_hpack_string_set_view(
+            name, static_name, strlen(static_name));
+    }
+    else if (!co_http2_hpack_dynamic_table_find_item_by_index(
+        dynamic_table, (*header_index), name, NULL))
+    {
+        return false;
+    }
+
+    if (!co_http2_hpack_deserialize_string(
+        data, data_size, value, &temp_index))
+    {
+        return false;
+    }
+
+    (*index) += temp_index;
+
+    return true;
+}
+
+static bool
+co_http2_hpack_string_equals(
+    const co_http2_hpack_string_st* str,
+    const char* literal,
+    size_t literal_length
+)
+{
+    return ((str->length == literal_length) &&
+        (co_string_case_compare_n(str->ptr, literal, literal_length) == 0));
+}
+
+#define co_http2_hpack_string_equals_literal(str, literal) \
+    co_http2_hpack_string_equals(str, literal, sizeof(literal) - 1)
+
+static bool
+co_http2_hpack_set_header_field(
+    co_http2_header_t* header,
+    co_http2_hpack_string_st* name,
+    co_http2_hpack_string_st* value
+)
+{
+    if (co_http2_hpack_string_equals_literal(name, ":authority"))
+    {
+        co_string_destroy(header->pseudo.authority);
+        header->pseudo.authority = co_http2_hpack_string_detach(value);
+    }
+    else if (co_http2_hpack_string_equals_literal(name, ":method"))
+    {
+        co_string_destroy(header->pseudo.method);
+        header->pseudo.method = co_http2_hpack_string_detach(value);
+    }
+    else if (co_http2_hpack_string_equals_literal(name, ":path"))
+    {
+        char* path = co_http2_hpack_string_detach(value);
+
+        if (path == NULL)
+        {
+            return false;
+        }
+
+        co_url_destroy(header->pseudo.url);
+        header->pseudo.url = co_url_create(path);
+
+        co_string_destroy(path);
+
+        if (header->pseudo.url == NULL)
         {
             return false;
         }
     }
-    else
+    else if (co_http2_hpack_string_equals_literal(name, ":scheme"))
     {
-        if ((*header_index) <= 61)
+        co_string_destroy(header->pseudo.scheme);
+        header->pseudo.scheme = co_http2_hpack_string_detach(value);
+    }
+    else if (co_http2_hpack_string_equals_literal(name, ":status"))
+    {
+        uint16_t status_code = 0;
+
+        for (size_t index = 0;
+            (index < value->length) &&
+            (value->ptr[index] >= '0') && (value->ptr[index] <= '9');
+            ++index)
         {
-            (*name) = co_string_duplicate(
-                hpack_static_name_table[(*header_index) - 1]);
-        }
-        else
-        {            
-            if (!co_http2_hpack_dynamic_table_find_item_by_index(
-                dynamic_table, (*header_index), name, NULL))
-            {
-                return false;
-            }
+            status_code =
+                (uint16_t)(status_code * 10 + (value->ptr[index] - '0'));
         }
 
-        if (!co_http2_hpack_deserialize_string(
-            data, data_size, value, &str_length, &temp_index))
+        header->pseudo.status_code = status_code;
+    }
+    else if (co_http2_hpack_string_equals_literal(name, ":protocol"))
+    {
+        co_string_destroy(header->pseudo.protocol);
+        header->pseudo.protocol = co_http2_hpack_string_detach(value);
+    }
+    else
+    {
+        char* field_name = co_http2_hpack_string_detach(name);
+        char* field_value = co_http2_hpack_string_detach(value);
+
+        if ((field_name == NULL) || (field_value == NULL))
         {
+            co_string_destroy(field_name);
+            co_string_destroy(field_value);
+
             return false;
         }
-    }
 
-    (*index) += temp_index;
+        co_http2_header_add_field_ptr(header, field_name, field_value);
+    }
 
     return true;
 }
@@ -808,8 +1317,12 @@ co_http2_hpack_deserialize_header(
         uint32_t header_index = 0;
         size_t index = 0;
 
-        char* name = NULL;
-        char* value = NULL;
+        // views into the tables or the data, copied once when
+        // they are set to the header
+        co_http2_hpack_string_st name = { NULL, 0, NULL };
+        co_http2_hpack_string_st value = { NULL, 0, NULL };
+
+        bool result = true;
 
         if (prefix & CO_HTTP2_FLAG_7_BITS)
         {
@@ -826,10 +1339,23 @@ co_http2_hpack_deserialize_header(
 
             if (header_index <= 61)
             {
-                name = co_string_duplicate(
-                    hpack_static_name_table[header_index - 1]);
-                value = co_string_duplicate(
-                    hpack_static_value_table[header_index - 1]);
+                const char* static_name =
+                    hpack_static_name_table[header_index - 1];
+                const char* static_value = (header_index <= 16) ?
+                    hpack_static_value_table[header_index - 1] : NULL;
+
+                co_http2_hpack_string_set_view(
+                    &name, static_name, strlen(static_name));
+
+                if (static_value != NULL)
+                {
+                    co_http2_hpack_string_set_view(
+                        &value, static_value, strlen(static_value));
+                }
+                else
+                {
+                    co_http2_hpack_string_set_view(&value, "", 0);
+                }
             }
             else
             {
@@ -846,11 +1372,34 @@ co_http2_hpack_deserialize_header(
                 CO_HTTP2_MAX_6_BITS, data, data_size, dynamic_table,
                 &header_index, &name, &value, &index))
             {
+                co_http2_hpack_string_release(&name);
+                co_http2_hpack_string_release(&value);
+
+                return false;
+            }
+
+            if (!co_http2_hpack_dynamic_table_add_item(dynamic_table,
+                name.ptr, name.length, value.ptr, value.length))
+            {
+                co_http2_hpack_string_release(&name);
+                co_http2_hpack_string_release(&value);
+
                 return false;
             }
 
-            co_http2_hpack_dynamic_table_add_item(
-                dynamic_table, name, value);
+            // the name may have been viewed in the arena, which the
+            // add can move. the new entry has the same bytes
+            if ((name.owned == NULL) && (header_index > 61) &&
+                (dynamic_table->entry_count > 0))
+            {
+                if (!co_http2_hpack_dynamic_table_find_item_by_index(
+                    dynamic_table, 62, &name, NULL))
+                {
+                    co_http2_hpack_string_release(&value);
+
+                    return false;
+                }
+            }
         }
         else if (prefix & CO_HTTP2_FLAG_5_BITS)
         {
@@ -872,59 +1421,24 @@ co_http2_hpack_deserialize_header(
                 CO_HTTP2_MAX_4_BITS, data, data_size, dynamic_table,
                 &header_index, &name, &value, &index))
             {
+                co_http2_hpack_string_release(&name);
+                co_http2_hpack_string_release(&value);
+
                 return false;
             }
         }
 
-        if ((name != NULL) && (value != NULL))
+        if ((name.ptr != NULL) && (value.ptr != NULL))
         {
-            if (co_string_case_compare(name, ":authority") == 0)
-            {
-                header->pseudo.authority = value;
-
-                co_string_destroy(name);
-            }
-            else if (co_string_case_compare(name, ":method") == 0)
-            {
-                header->pseudo.method = value;
-
-                co_string_destroy(name);
-            }
-            else if (co_string_case_compare(name, ":path") == 0)
-            {
-                header->pseudo.url = co_url_create(value);
-
-                co_string_destroy(name);
-                co_string_destroy(value);
-
-                if (header->pseudo.url == NULL)
-                {
-                    return false;
-                }
-            }
-            else if (co_string_case_compare(name, ":scheme") == 0)
-            {
-                header->pseudo.scheme = value;
-
-                co_string_destroy(name);
-            }
-            else if (co_string_case_compare(name, ":status") == 0)
-            {
-                header->pseudo.status_code = (uint16_t)strtoul(value, NULL, 10);
+            result = co_http2_hpack_set_header_field(header, &name, &value);
+        }
 
-                co_string_destroy(name);
-                co_string_destroy(value);
-            }
-            else if (co_string_case_compare(name, ":protocol") == 0)
-            {
-                header->pseudo.protocol = value;
+        co_http2_hpack_string_release(&name);
+        co_http2_hpack_string_release(&value);
 
-                co_string_destroy(name);
-            }
-            else
-            {
-                co_http2_header_add_field_ptr(header, name, value);
-            }
+        if (!result)
+        {
+            return false;
         }
 
         data_size -= index;
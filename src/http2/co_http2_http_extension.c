@@ -126,11 +126,11 @@ co_http_request_is_http2_upgrade(
         co_http_request_get_const_header(request);
 
     const char* connection =
-        co_http_header_get_field(
-            header, CO_HTTP_HEADER_CONNECTION);
+        co_http_header_get_field_by_id(
+            header, CO_HTTP_HEADER_ID_CONNECTION);
     const char* upgrade =
-        co_http_header_get_field(
-            header, CO_HTTP_HEADER_UPGRADE);
+        co_http_header_get_field_by_id(
+            header, CO_HTTP_HEADER_ID_UPGRADE);
     const char* http2_settings =
         co_http_header_get_field(
             header, CO_HTTP2_HEADER_SETTINGS);
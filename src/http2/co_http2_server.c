@@ -77,8 +77,8 @@ co_http2_server_on_upgrade_request(
     const co_http_header_t* request_header =
         co_http_request_get_header(request);
     const char* upgrade =
-        co_http_header_get_field(
-            request_header, CO_HTTP_HEADER_UPGRADE);
+        co_http_header_get_field_by_id(
+            request_header, CO_HTTP_HEADER_ID_UPGRADE);
     const char* http2_settings =
         co_http_header_get_field(
             request_header, CO_HTTP2_HEADER_SETTINGS);
@@ -109,20 +109,12 @@ co_http2_server_on_upgrade_request(
     return true;
 }
 
-void
-co_http2_server_on_tcp_receive_ready(
-    co_thread_t* thread,
-    co_tcp_client_t* tcp_client
+static void
+co_http2_server_receive_frames(
+    co_http2_client_t* client
 )
 {
-    (void)thread;
-
-    co_http2_client_t* client =
-        (co_http2_client_t*)tcp_client->sock.sub_class;
-
-    client->conn.module.receive_all(
-        client->conn.tcp_client,
-        client->conn.receive_data.ptr);
+    co_http_connection_receive(&client->conn);
 
     size_t data_size =
         co_byte_array_get_count(client->conn.receive_data.ptr);
@@ -244,8 +236,23 @@ co_http2_server_on_tcp_receive_ready(
         }
     }
 
-    client->conn.receive_data.index = 0;
-    co_byte_array_clear(client->conn.receive_data.ptr);
+    co_http_connection_clear_receive_data(&client->conn);
+}
+
+void
+co_http2_server_on_tcp_receive_ready(
+    co_thread_t* thread,
+    co_tcp_client_t* tcp_client
+)
+{
+    (void)thread;
+
+    co_http2_client_t* client =
+        (co_http2_client_t*)tcp_client->sock.sub_class;
+
+    co_http2_cork(client);
+    co_http2_server_receive_frames(client);
+    co_http2_uncork(client);
 }
 
 //---------------------------------------------------------------------------//
@@ -59,6 +59,17 @@ co_http2_stream_create(
         client->remote_settings.initial_window_size;
     stream->local_window_size = stream->max_local_window_size;
 
+    stream->send_data_pool.data = NULL;
+    stream->send_data_pool.index = 0;
+    stream->send_data_pool.end_stream = false;
+    stream->send_data_pool.waiting = false;
+
+    stream->priority.urgency = CO_HTTP2_PRIORITY_DEFAULT_URGENCY;
+    stream->priority.incremental = true;
+    stream->priority.stream_dependency = 0;
+    stream->priority.weight = CO_HTTP2_STREAM_DEFAULT_WEIGHT;
+    stream->priority.pass = 0;
+
     stream->promised_stream_id = 0;
 
     stream->protocol.name = NULL;
@@ -67,6 +78,67 @@ co_http2_stream_create(
     return stream;
 }
 
+static void
+co_http2_stream_clear_send_data(
+    co_http2_stream_t* stream
+)
+{
+    co_byte_array_destroy(stream->send_data_pool.data);
+    stream->send_data_pool.data = NULL;
+    stream->send_data_pool.index = 0;
+    stream->send_data_pool.end_stream = false;
+
+    if (stream->send_data_pool.waiting)
+    {
+        co_list_remove(stream->client->send_waiting_streams, stream);
+
+        stream->send_data_pool.waiting = false;
+    }
+}
+
+static void
+co_http2_stream_set_dependency(
+    co_http2_stream_t* stream,
+    uint32_t stream_dependency,
+    uint8_t weight
+)
+{
+    // without the exclusive flag, the wire weight is one less
+    stream->priority.stream_dependency = stream_dependency & 0x7fffffff;
+    stream->priority.weight = (uint16_t)weight + 1;
+}
+
+static void
+co_http2_stream_update_priority(
+    co_http2_stream_t* stream
+)
+{
+    // a priority field on the response overrides the request's.
+    // without one, streams share by weight as in RFC 7540
+
+    uint8_t urgency = CO_HTTP2_PRIORITY_DEFAULT_URGENCY;
+    bool incremental = false;
+
+    if (((stream->send_header == NULL) ||
+        !co_http2_header_get_priority(
+            stream->send_header, &urgency, &incremental)) &&
+        ((stream->receive_header == NULL) ||
+        !co_http2_header_get_priority(
+            stream->receive_header, &urgency, &incremental)))
+    {
+        incremental = true;
+    }
+
+    stream->priority.urgency = urgency;
+    stream->priority.incremental = incremental;
+
+    // a stream joining the incremental ones starts at the current turn
+    if (stream->priority.pass < stream->client->send_pass)
+    {
+        stream->priority.pass = stream->client->send_pass;
+    }
+}
+
 void
 co_http2_stream_destroy(
     co_http2_stream_t* stream
@@ -86,6 +158,8 @@ co_http2_stream_destroy(
         co_byte_array_destroy(stream->receive_data_pool);
         stream->receive_data_pool = NULL;
 
+        co_http2_stream_clear_send_data(stream);
+
         if (stream->receive_data.ptr != NULL)
         {
             co_mem_free(stream->receive_data.ptr);
@@ -147,14 +221,7 @@ co_http2_stream_update_remote_window_size(
     uint32_t consumed_size
 )
 {
-    if (stream->remote_window_size > consumed_size)
-    {
-        stream->remote_window_size -= consumed_size;
-    }
-    else
-    {
-        stream->remote_window_size = 0;
-    }
+    stream->remote_window_size -= (int64_t)consumed_size;
 }
 
 static int
@@ -419,15 +486,18 @@ co_http2_stream_send_frame(
         frame,
         "http2 send frame");
 
-    co_byte_array_t* buffer = co_byte_array_create();
+    // the frame prefix is serialized straight onto the connection
+    // send buffer, only a DATA payload is left in place
+
+    co_buffer_st buffers[CO_HTTP2_FRAME_MAX_VEC_COUNT];
 
-    co_http2_frame_serialize(frame, buffer);
+    const size_t buffer_count =
+        co_http2_frame_serialize_vec(
+            frame, stream->client->send_buffer, buffers);
 
     bool result =
-        co_http_connection_send_data(
-            &stream->client->conn,
-            co_byte_array_get_ptr(buffer, 0),
-            co_byte_array_get_count(buffer));
+        co_http2_client_send_buffers(
+            stream->client, &buffers[1], buffer_count - 1);
 
     if (result &&
         (frame->header.type == CO_HTTP2_FRAME_TYPE_DATA))
@@ -438,13 +508,122 @@ co_http2_stream_send_frame(
             stream, frame->header.length);
     }
 
-    co_byte_array_destroy(buffer);
-
     co_http2_frame_destroy(frame);
 
     return result;
 }
 
+static ssize_t
+co_http2_stream_send_data_frames(
+    co_http2_stream_t* stream,
+    bool end_stream,
+    const uint8_t* data,
+    size_t data_size
+)
+{
+    // END_STREAM goes with the last byte, so it waits with the data
+
+    const uint32_t max_frame_size =
+        stream->client->remote_settings.max_frame_size;
+
+    size_t index = 0;
+    bool result = true;
+
+    co_http2_cork(stream->client);
+
+    do
+    {
+        const size_t window_size = co_min(
+            (size_t)co_http2_stream_get_sendable_data_size(stream),
+            (size_t)max_frame_size);
+
+        size_t frame_size = data_size - index;
+
+        if (frame_size > window_size)
+        {
+            if (window_size == 0)
+            {
+                break;
+            }
+
+            frame_size = window_size;
+        }
+
+        const bool last =
+            (end_stream && ((index + frame_size) == data_size));
+
+        co_http2_frame_t* data_frame =
+            co_http2_create_data_frame(
+                false, last, &data[index], (uint32_t)frame_size,
+                NULL, 0);
+
+        if (!co_http2_stream_send_frame(stream, data_frame))
+        {
+            result = false;
+
+            break;
+        }
+
+        index += frame_size;
+
+    } while (index < data_size);
+
+    if (!co_http2_uncork(stream->client) || !result)
+    {
+        return -1;
+    }
+
+    return (ssize_t)index;
+}
+
+ssize_t
+co_http2_stream_send_pending_data(
+    co_http2_stream_t* stream,
+    size_t max_size
+)
+{
+    co_byte_array_t* pool = stream->send_data_pool.data;
+
+    if (pool == NULL)
+    {
+        return 0;
+    }
+
+    const size_t index = stream->send_data_pool.index;
+    const size_t pending_size = co_byte_array_get_count(pool) - index;
+    const size_t size = co_min(pending_size, max_size);
+
+    ssize_t sent_size = co_http2_stream_send_data_frames(
+        stream,
+        (stream->send_data_pool.end_stream && (size == pending_size)),
+        co_byte_array_get_ptr(pool, index), size);
+
+    if (sent_size < 0)
+    {
+        co_http2_stream_clear_send_data(stream);
+
+        return -1;
+    }
+
+    stream->send_data_pool.index += (size_t)sent_size;
+
+    if (stream->send_data_pool.index < co_byte_array_get_count(pool))
+    {
+        return sent_size;
+    }
+
+    co_http2_stream_clear_send_data(stream);
+
+    if (stream->client->callbacks.on_send_complete != NULL)
+    {
+        stream->client->callbacks.on_send_complete(
+            stream->client->conn.tcp_client->sock.owner_thread,
+            stream->client, stream);
+    }
+
+    return sent_size;
+}
+
 static bool
 co_http2_stream_on_receive_finish(
     co_http2_stream_t* stream,
@@ -624,6 +803,10 @@ co_http2_stream_on_receive_frame(
                 frame->payload.headers.stream_dependency;
             stream->receive_header->weight =
                 frame->payload.headers.weight;
+
+            co_http2_stream_set_dependency(stream,
+                frame->payload.headers.stream_dependency,
+                frame->payload.headers.weight);
         }
 
         if (frame->header.flags & CO_HTTP2_FRAME_FLAG_END_HEADERS)
@@ -703,6 +886,10 @@ co_http2_stream_on_receive_frame(
     }
     case CO_HTTP2_FRAME_TYPE_PRIORITY:
     {
+        co_http2_stream_set_dependency(stream,
+            frame->payload.priority.stream_dependency,
+            frame->payload.priority.weight);
+
         if (stream->client->callbacks.on_priority != NULL)
         {
             stream->client->callbacks.on_priority(
@@ -716,6 +903,8 @@ co_http2_stream_on_receive_frame(
     }
     case CO_HTTP2_FRAME_TYPE_RST_STREAM:
     {
+        co_http2_stream_clear_send_data(stream);
+
         if (stream->client->callbacks.on_close_stream != NULL)
         {
             stream->client->callbacks.on_close_stream(
@@ -814,6 +1003,8 @@ co_http2_stream_on_receive_frame(
         stream->remote_window_size +=
             frame->payload.window_update.window_size_increment;
 
+        co_http2_client_send_pending_data(stream->client);
+
         if (stream->client->callbacks.on_window_update != NULL)
         {
             stream->client->callbacks.on_window_update(
@@ -938,78 +1129,108 @@ co_http2_stream_send_data(
     uint32_t data_size
 )
 {
-    if (stream->id == 0)
+    if ((stream->id == 0) ||
+        (data_size > INT32_MAX) ||
+        stream->send_data_pool.end_stream)
     {
         return -1;
     }
 
-    if (data_size > INT32_MAX)
+    if ((data_size == 0) && !end_stream)
     {
-        return -1;
+        return 0;
     }
 
-    uint8_t* data_ptr = (uint8_t*)data;
+    const uint8_t* data_ptr = (const uint8_t*)data;
+    size_t sent_size = 0;
 
-    uint32_t total_data_size = (uint32_t)data_size;
-    uint32_t max_frame_size =
-        stream->client->remote_settings.max_frame_size;
-    uint32_t window_size =
-        co_http2_stream_get_sendable_data_size(stream);
+    // behind data already held back, nothing can pass it. while other
+    // streams hold data back, the scheduler decides who goes first
+    const bool contended =
+        (co_http2_client_select_send_stream(stream->client) != NULL);
 
-    if (total_data_size > window_size)
+    if ((stream->send_data_pool.data == NULL) && !contended)
     {
-        total_data_size -= window_size;
+        ssize_t result = co_http2_stream_send_data_frames(
+            stream, end_stream, data_ptr, data_size);
+
+        if (result < 0)
+        {
+            return -1;
+        }
+
+        sent_size = (size_t)result;
+
+        if (sent_size == data_size)
+        {
+            return (ssize_t)sent_size;
+        }
     }
 
-    if (total_data_size > max_frame_size)
+    size_t pool_size = 0;
+
+    if (stream->send_data_pool.data != NULL)
     {
-        uint32_t index = 0;
-        uint32_t frame_size = max_frame_size;
+        pool_size = co_byte_array_get_count(stream->send_data_pool.data) -
+            stream->send_data_pool.index;
+    }
 
-        co_http2_frame_t* data_frame =
-            co_http2_create_data_frame(
-                false, false, data_ptr, frame_size, NULL, 0);
+    const size_t max_pool_size = stream->client->max_send_data_pool_size;
+    size_t hold_size = data_size - sent_size;
 
-        co_http2_stream_send_frame(stream, data_frame);
+    if ((pool_size + hold_size) > max_pool_size)
+    {
+        hold_size = (max_pool_size > pool_size) ?
+            (max_pool_size - pool_size) : 0;
+    }
 
-        index += frame_size;
+    if ((hold_size == 0) && (sent_size < data_size))
+    {
+        return (ssize_t)sent_size;
+    }
 
-        do
+    if (stream->send_data_pool.data == NULL)
+    {
+        stream->send_data_pool.data = co_byte_array_create();
+
+        if (stream->send_data_pool.data == NULL)
         {
-            bool last = false;
+            return (ssize_t)sent_size;
+        }
+    }
+    else if (stream->send_data_pool.index > 0)
+    {
+        co_byte_array_remove(stream->send_data_pool.data,
+            0, stream->send_data_pool.index);
 
-            if ((total_data_size - index) > max_frame_size)
-            {
-                frame_size = max_frame_size;
-            }
-            else
-            {
-                frame_size = total_data_size - index;
+        stream->send_data_pool.index = 0;
+    }
 
-                last = end_stream;
-            }
+    co_byte_array_add(
+        stream->send_data_pool.data, &data_ptr[sent_size], hold_size);
 
-            data_frame = co_http2_create_data_frame(
-                false, last, &data_ptr[index], frame_size,
-                NULL, 0);
+    if ((sent_size + hold_size) == data_size)
+    {
+        stream->send_data_pool.end_stream = end_stream;
+    }
 
-            co_http2_stream_send_frame(stream, data_frame);
+    if (!stream->send_data_pool.waiting)
+    {
+        co_http2_stream_update_priority(stream);
 
-            index += frame_size;
+        co_list_add_tail(stream->client->send_waiting_streams, stream);
 
-        } while (total_data_size > index);
+        stream->send_data_pool.waiting = true;
     }
-    else
-    {
-        co_http2_frame_t* data_frame =
-            co_http2_create_data_frame(
-                false, end_stream,
-                data_ptr, total_data_size, NULL, 0);
 
-        co_http2_stream_send_frame(stream, data_frame);
+    const ssize_t result = (ssize_t)(sent_size + hold_size);
+
+    if (contended)
+    {
+        co_http2_client_send_pending_data(stream->client);
     }
 
-    return total_data_size;
+    return result;
 }
 
 bool
@@ -1350,7 +1571,8 @@ co_http2_stream_get_remote_window_size(
     const co_http2_stream_t* stream
 )
 {
-    return stream->remote_window_size;
+    return (stream->remote_window_size > 0) ?
+        (uint32_t)stream->remote_window_size : 0;
 }
 
 uint32_t
@@ -1364,8 +1586,23 @@ co_http2_stream_get_sendable_data_size(
     }
 
     return co_min(
-        stream->client->system_stream->remote_window_size,
-        stream->remote_window_size);
+        co_http2_stream_get_remote_window_size(
+            stream->client->system_stream),
+        co_http2_stream_get_remote_window_size(stream));
+}
+
+size_t
+co_http2_stream_get_pending_data_size(
+    const co_http2_stream_t* stream
+)
+{
+    if (stream->send_data_pool.data == NULL)
+    {
+        return 0;
+    }
+
+    return co_byte_array_get_count(stream->send_data_pool.data) -
+        stream->send_data_pool.index;
 }
 
 bool
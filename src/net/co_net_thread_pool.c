@@ -0,0 +1,466 @@
+#include <coldforce/core/co_std.h>
+
+#include <coldforce/net/co_net_thread_pool.h>
+#include <coldforce/net/co_net_thread.h>
+#include <coldforce/net/co_net_worker.h>
+#include <coldforce/net/co_net_log.h>
+
+//---------------------------------------------------------------------------//
+// net thread pool
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+// private
+//---------------------------------------------------------------------------//
+
+static size_t
+co_net_pool_thread_get_load(
+    const co_net_pool_thread_t* thread
+)
+{
+    const co_net_worker_t* net_worker =
+        (const co_net_worker_t*)thread->base_thread.event_worker;
+
+    return (size_t)(co_atomic_load(&net_worker->connection_count) +
+        co_atomic_load(&thread->pending_count));
+}
+
+static void
+co_net_pool_thread_on_tcp_accept(
+    co_net_pool_thread_t* thread,
+    co_tcp_server_t* unused,
+    co_tcp_client_t* client
+)
+{
+    (void)unused;
+
+    co_atomic_decrement(&thread->pending_count);
+
+    if (!co_tcp_accept((co_thread_t*)thread, client))
+    {
+        co_tcp_client_destroy(client);
+
+        return;
+    }
+
+    co_atomic_increment(&thread->accept_count);
+
+    if (thread->pool->callbacks.on_tcp_accept != NULL)
+    {
+        thread->pool->callbacks.on_tcp_accept(
+            (co_thread_t*)thread, NULL, client);
+    }
+    else
+    {
+        co_tcp_client_destroy(client);
+    }
+}
+
+static void
+co_net_pool_thread_on_udp_accept(
+    co_net_pool_thread_t* thread,
+    co_udp_server_t* unused,
+    co_udp_t* udp_conn
+)
+{
+    (void)unused;
+
+    co_atomic_decrement(&thread->pending_count);
+
+    if (!co_udp_accept((co_thread_t*)thread, udp_conn))
+    {
+        co_udp_destroy(udp_conn);
+
+        return;
+    }
+
+    co_atomic_increment(&thread->accept_count);
+
+    if (thread->pool->callbacks.on_udp_accept != NULL)
+    {
+        thread->pool->callbacks.on_udp_accept(
+            (co_thread_t*)thread, NULL, udp_conn);
+    }
+    else
+    {
+        co_udp_destroy(udp_conn);
+    }
+}
+
+static bool
+co_net_pool_thread_on_create(
+    co_net_pool_thread_t* thread
+)
+{
+    if (thread->cpu != CO_NET_THREAD_POOL_CPU_ANY)
+    {
+        if (!co_thread_set_cpu_affinity(thread->cpu))
+        {
+            co_core_log_warning(
+                "net thread pool: failed to pin thread-%zu to cpu %d",
+                thread->index, thread->cpu);
+        }
+    }
+
+    co_net_thread_callbacks_st* callbacks =
+        co_net_thread_get_callbacks((co_thread_t*)thread);
+    callbacks->on_tcp_accept =
+        (co_tcp_accept_fn)co_net_pool_thread_on_tcp_accept;
+    callbacks->on_udp_accept =
+        (co_udp_accept_fn)co_net_pool_thread_on_udp_accept;
+
+    if (thread->pool->callbacks.on_thread_create != NULL)
+    {
+        return thread->pool->callbacks.on_thread_create(
+            (co_thread_t*)thread);
+    }
+
+    return true;
+}
+
+static void
+co_net_pool_thread_on_destroy(
+    co_net_pool_thread_t* thread
+)
+{
+    if (thread->pool->callbacks.on_thread_destroy != NULL)
+    {
+        thread->pool->callbacks.on_thread_destroy(
+            (co_thread_t*)thread);
+    }
+}
+
+static co_net_pool_thread_t*
+co_net_thread_pool_select(
+    co_net_thread_pool_t* pool
+)
+{
+    const size_t start =
+        (size_t)co_atomic_fetch_add(&pool->next_index, 1) %
+            pool->thread_count;
+
+    if (pool->distribution ==
+        CO_NET_THREAD_POOL_DISTRIBUTION_ROUND_ROBIN)
+    {
+        return &pool->threads[start];
+    }
+
+    // least connections, ties are broken by the rotating start index
+
+    size_t best_index = start;
+    size_t best_load =
+        co_net_pool_thread_get_load(&pool->threads[start]);
+
+    for (size_t count = 1; count < pool->thread_count; ++count)
+    {
+        size_t index = start + count;
+
+        if (index >= pool->thread_count)
+        {
+            index -= pool->thread_count;
+        }
+
+        const size_t load =
+            co_net_pool_thread_get_load(&pool->threads[index]);
+
+        if (load < best_load)
+        {
+            best_index = index;
+            best_load = load;
+        }
+    }
+
+    return &pool->threads[best_index];
+}
+
+static void
+co_net_thread_pool_stop_threads(
+    co_net_thread_pool_t* pool,
+    size_t thread_count
+)
+{
+    for (size_t index = 0; index < thread_count; ++index)
+    {
+        co_thread_stop((co_thread_t*)&pool->threads[index]);
+    }
+
+    for (size_t index = 0; index < thread_count; ++index)
+    {
+        co_thread_join((co_thread_t*)&pool->threads[index]);
+        co_net_thread_cleanup((co_thread_t*)&pool->threads[index]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// public
+//---------------------------------------------------------------------------//
+
+co_net_thread_pool_t*
+co_net_thread_pool_create(
+    size_t thread_count,
+    co_net_thread_pool_distribution_t distribution
+)
+{
+    if (thread_count == 0)
+    {
+        return NULL;
+    }
+
+    co_net_thread_pool_t* pool =
+        (co_net_thread_pool_t*)co_mem_alloc(sizeof(co_net_thread_pool_t));
+
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+
+    pool->threads = (co_net_pool_thread_t*)co_mem_alloc(
+        sizeof(co_net_pool_thread_t) * thread_count);
+
+    if (pool->threads == NULL)
+    {
+        co_mem_free(pool);
+
+        return NULL;
+    }
+
+    memset(pool->threads, 0x00,
+        sizeof(co_net_pool_thread_t) * thread_count);
+
+    for (size_t index = 0; index < thread_count; ++index)
+    {
+        pool->threads[index].pool = pool;
+        pool->threads[index].index = index;
+        pool->threads[index].cpu = CO_NET_THREAD_POOL_CPU_ANY;
+    }
+
+    pool->thread_count = thread_count;
+    pool->distribution = distribution;
+    pool->next_index = 0;
+    pool->running = false;
+
+    pool->callbacks.on_thread_create = NULL;
+    pool->callbacks.on_thread_destroy = NULL;
+    pool->callbacks.on_tcp_accept = NULL;
+    pool->callbacks.on_udp_accept = NULL;
+
+    return pool;
+}
+
+void
+co_net_thread_pool_destroy(
+    co_net_thread_pool_t* pool
+)
+{
+    if (pool != NULL)
+    {
+        co_net_thread_pool_stop(pool);
+
+        co_mem_free(pool->threads);
+        co_mem_free(pool);
+    }
+}
+
+co_net_thread_pool_callbacks_st*
+co_net_thread_pool_get_callbacks(
+    co_net_thread_pool_t* pool
+)
+{
+    return &pool->callbacks;
+}
+
+bool
+co_net_thread_pool_set_cpu_affinity(
+    co_net_thread_pool_t* pool,
+    size_t index,
+    int cpu
+)
+{
+    if (pool->running || (index >= pool->thread_count))
+    {
+        return false;
+    }
+
+    pool->threads[index].cpu = cpu;
+
+    return true;
+}
+
+bool
+co_net_thread_pool_start(
+    co_net_thread_pool_t* pool
+)
+{
+    if (pool->running)
+    {
+        return true;
+    }
+
+    for (size_t index = 0; index < pool->thread_count; ++index)
+    {
+        co_net_pool_thread_t* thread = &pool->threads[index];
+
+        thread->pending_count = 0;
+        thread->accept_count = 0;
+
+        if (!co_net_thread_setup(
+            (co_thread_t*)thread, "net-pool-thread",
+            (co_thread_create_fn)co_net_pool_thread_on_create,
+            (co_thread_destroy_fn)co_net_pool_thread_on_destroy))
+        {
+            co_net_thread_pool_stop_threads(pool, index);
+
+            return false;
+        }
+
+        if (!co_thread_start((co_thread_t*)thread))
+        {
+            co_net_thread_cleanup((co_thread_t*)thread);
+            co_net_thread_pool_stop_threads(pool, index);
+
+            return false;
+        }
+    }
+
+    pool->running = true;
+
+    return true;
+}
+
+void
+co_net_thread_pool_stop(
+    co_net_thread_pool_t* pool
+)
+{
+    if (pool->running)
+    {
+        co_net_thread_pool_stop_threads(pool, pool->thread_count);
+
+        pool->running = false;
+    }
+}
+
+bool
+co_net_thread_pool_tcp_accept(
+    co_net_thread_pool_t* pool,
+    co_tcp_client_t* client
+)
+{
+    if (!pool->running)
+    {
+        return false;
+    }
+
+    co_net_pool_thread_t* thread = co_net_thread_pool_select(pool);
+
+    co_atomic_increment(&thread->pending_count);
+
+    if (!co_tcp_accept((co_thread_t*)thread, client))
+    {
+        co_atomic_decrement(&thread->pending_count);
+
+        return false;
+    }
+
+    return true;
+}
+
+bool
+co_net_thread_pool_udp_accept(
+    co_net_thread_pool_t* pool,
+    co_udp_t* udp_conn
+)
+{
+    if (!pool->running)
+    {
+        return false;
+    }
+
+    co_net_pool_thread_t* thread = co_net_thread_pool_select(pool);
+
+    co_atomic_increment(&thread->pending_count);
+
+    // co_udp_accept destroys udp_conn when it fails to hand it off
+    if (!co_udp_accept((co_thread_t*)thread, udp_conn))
+    {
+        co_atomic_decrement(&thread->pending_count);
+
+        return false;
+    }
+
+    return true;
+}
+
+size_t
+co_net_thread_pool_get_thread_count(
+    const co_net_thread_pool_t* pool
+)
+{
+    return pool->thread_count;
+}
+
+co_thread_t*
+co_net_thread_pool_get_thread(
+    co_net_thread_pool_t* pool,
+    size_t index
+)
+{
+    if (index >= pool->thread_count)
+    {
+        return NULL;
+    }
+
+    return (co_thread_t*)&pool->threads[index];
+}
+
+void
+co_net_thread_pool_set_user_data(
+    co_net_thread_pool_t* pool,
+    size_t index,
+    void* user_data
+)
+{
+    if (index < pool->thread_count)
+    {
+        pool->threads[index].user_data = user_data;
+    }
+}
+
+void*
+co_net_pool_thread_get_user_data(
+    const co_thread_t* thread
+)
+{
+    return ((const co_net_pool_thread_t*)thread)->user_data;
+}
+
+void
+co_net_thread_pool_get_stats(
+    const co_net_thread_pool_t* pool,
+    size_t index,
+    co_net_thread_pool_stats_st* stats
+)
+{
+    const co_net_pool_thread_t* thread = &pool->threads[index];
+
+    stats->pending_count =
+        (size_t)co_atomic_load(&thread->pending_count);
+    stats->accept_count =
+        (size_t)co_atomic_load(&thread->accept_count);
+    stats->connection_count = 0;
+
+    if (pool->running)
+    {
+        const co_net_worker_t* net_worker =
+            (const co_net_worker_t*)thread->base_thread.event_worker;
+
+        stats->connection_count =
+            (size_t)co_atomic_load(&net_worker->connection_count);
+    }
+}
+
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
@@ -65,6 +65,34 @@ co_net_worker_on_udp_accept(
     }
 }
 
+static bool
+co_net_worker_add_socket(
+    co_list_t* list,
+    co_socket_t* sock,
+    void* value
+)
+{
+    if (!co_list_add_tail(list, value))
+    {
+        return false;
+    }
+
+    sock->worker_it = co_list_get_tail_iterator(list);
+
+    return true;
+}
+
+static void
+co_net_worker_remove_socket(
+    co_list_t* list,
+    co_socket_t* sock
+)
+{
+    co_list_remove_at(list, sock->worker_it);
+
+    sock->worker_it = NULL;
+}
+
 co_net_worker_t*
 co_net_worker_create(
     void
@@ -87,6 +115,7 @@ co_net_worker_create(
     net_worker->tcp_servers = NULL;
     net_worker->tcp_clients = NULL;
     net_worker->udps = NULL;
+    net_worker->connection_count = 0;
 
     net_worker->callbacks.on_tcp_accept = NULL;
     net_worker->callbacks.on_udp_accept = NULL;
@@ -110,6 +139,9 @@ co_net_worker_cleanup(
         return;
     }
 
+    // no producer may wake up the selector after it is gone
+    co_event_worker_stop_receiving(&net_worker->event_worker);
+
     if (net_worker->tcp_servers != NULL)
     {
         co_list_destroy(net_worker->tcp_servers);
@@ -295,8 +327,14 @@ co_net_worker_register_tcp_server(
         net_worker->tcp_servers = co_list_create(NULL);
     }
 
-    co_list_add_tail(
-        net_worker->tcp_servers, server);
+    if (!co_net_worker_add_socket(
+        net_worker->tcp_servers, &server->sock, server))
+    {
+        co_net_selector_unregister(
+            net_worker->net_selector, &server->sock);
+
+        return false;
+    }
 
     return true;
 }
@@ -307,20 +345,14 @@ co_net_worker_unregister_tcp_server(
     co_tcp_server_t* server
 )
 {
-    if (net_worker->tcp_servers == NULL)
-    {
-        return;
-    }
-
-    co_list_iterator_t* it =
-        co_list_find(net_worker->tcp_servers, server);
-
-    if (it == NULL)
+    if ((net_worker->tcp_servers == NULL) ||
+        (server->sock.worker_it == NULL))
     {
         return;
     }
 
-    co_list_remove_at(net_worker->tcp_servers, it);
+    co_net_worker_remove_socket(
+        net_worker->tcp_servers, &server->sock);
 
     co_net_selector_unregister(
         net_worker->net_selector, &server->sock);
@@ -337,8 +369,7 @@ co_net_worker_register_tcp_connector(
         net_worker->tcp_clients = co_list_create(NULL);
     }
 
-    if (co_list_contains(
-        net_worker->tcp_clients, client))
+    if (client->sock.worker_it != NULL)
     {
         return true;
     }
@@ -350,8 +381,16 @@ co_net_worker_register_tcp_connector(
         return false;
     }
 
-    co_list_add_tail(
-        net_worker->tcp_clients, client);
+    if (!co_net_worker_add_socket(
+        net_worker->tcp_clients, &client->sock, client))
+    {
+        co_net_selector_unregister(
+            net_worker->net_selector, &client->sock);
+
+        return false;
+    }
+
+    co_atomic_increment(&net_worker->connection_count);
 
     return true;
 }
@@ -362,20 +401,15 @@ co_net_worker_unregister_tcp_connector(
     co_tcp_client_t* client
 )
 {
-    if (net_worker->tcp_clients == NULL)
-    {
-        return;
-    }
-
-    co_list_iterator_t* it =
-        co_list_find(net_worker->tcp_clients, client);
-
-    if (it == NULL)
+    if ((net_worker->tcp_clients == NULL) ||
+        (client->sock.worker_it == NULL))
     {
         return;
     }
 
-    co_list_remove_at(net_worker->tcp_clients, it);
+    co_net_worker_remove_socket(
+        net_worker->tcp_clients, &client->sock);
+    co_atomic_decrement(&net_worker->connection_count);
 
     co_net_selector_unregister(
         net_worker->net_selector, &client->sock);
@@ -392,8 +426,7 @@ co_net_worker_register_tcp_connection(
         net_worker->tcp_clients = co_list_create(NULL);
     }
 
-    if (co_list_contains(
-        net_worker->tcp_clients, client))
+    if (client->sock.worker_it != NULL)
     {
         return true;
     }
@@ -405,8 +438,16 @@ co_net_worker_register_tcp_connection(
         return false;
     }
 
-    co_list_add_tail(
-        net_worker->tcp_clients, client);
+    if (!co_net_worker_add_socket(
+        net_worker->tcp_clients, &client->sock, client))
+    {
+        co_net_selector_unregister(
+            net_worker->net_selector, &client->sock);
+
+        return false;
+    }
+
+    co_atomic_increment(&net_worker->connection_count);
 
     return true;
 }
@@ -416,25 +457,22 @@ co_net_worker_unregister_tcp_connection(
     co_net_worker_t* net_worker,
     co_tcp_client_t* client)
 {
-    if (net_worker->tcp_clients != NULL)
+    if ((net_worker->tcp_clients != NULL) &&
+        (client->sock.worker_it != NULL))
     {
-        co_list_iterator_t* it =
-            co_list_find(net_worker->tcp_clients, client);
-
-        if (it != NULL)
+        if (client->close_timer != NULL)
         {
-            if (client->close_timer != NULL)
-            {
-                co_timer_stop(client->close_timer);
-                co_timer_destroy(client->close_timer);
+            co_timer_stop(client->close_timer);
+            co_timer_destroy(client->close_timer);
 
-                client->close_timer = NULL;
-            }
+            client->close_timer = NULL;
+        }
 
-            co_list_remove_at(net_worker->tcp_clients, it);
+        co_net_worker_remove_socket(
+            net_worker->tcp_clients, &client->sock);
+        co_atomic_decrement(&net_worker->connection_count);
 
-            co_net_selector_unregister(net_worker->net_selector, &client->sock);
-        }
+        co_net_selector_unregister(net_worker->net_selector, &client->sock);
     }
 }
 
@@ -482,9 +520,15 @@ co_net_worker_close_tcp_client_local(
         return false;
     }
 
-    co_socket_handle_shutdown(
-        client->sock.handle,
-        CO_SOCKET_SHUTDOWN_SEND);
+#ifndef CO_OS_WIN
+    // with buffered send data, shutdown after the buffer drains
+    if (!co_tcp_client_is_send_pending(client))
+#endif
+    {
+        co_socket_handle_shutdown(
+            client->sock.handle,
+            CO_SOCKET_SHUTDOWN_SEND);
+    }
 
     client->close_timer = co_timer_create(timeout_msec,
         (co_timer_fn)co_net_worker_tcp_client_close_timer,
@@ -501,8 +545,7 @@ co_net_worker_close_tcp_client_remote(
     co_tcp_client_t* client
 )
 {
-    if (!co_list_contains(
-        net_worker->tcp_clients, client))
+    if (client->sock.worker_it == NULL)
     {
         return false;
     }
@@ -544,7 +587,16 @@ co_net_worker_register_udp(
     }
 #endif
 
-    co_list_add_tail(net_worker->udps, udp);
+    if (!co_net_worker_add_socket(
+        net_worker->udps, &udp->sock, udp))
+    {
+        co_net_selector_unregister(
+            net_worker->net_selector, &udp->sock);
+
+        return false;
+    }
+
+    co_atomic_increment(&net_worker->connection_count);
 
     return true;
 }
@@ -555,20 +607,15 @@ co_net_worker_unregister_udp(
     co_udp_t* udp
 )
 {
-    if (net_worker->udps == NULL)
+    if ((net_worker->udps == NULL) ||
+        (udp->sock.worker_it == NULL))
     {
         return;
     }
 
-    co_list_iterator_t* it =
-        co_list_find(net_worker->udps, udp);
-
-    if (it == NULL)
-    {
-        return;
-    }
-
-    co_list_remove_at(net_worker->udps, it);
+    co_net_worker_remove_socket(
+        net_worker->udps, &udp->sock);
+    co_atomic_decrement(&net_worker->connection_count);
 
     co_net_selector_unregister(
         net_worker->net_selector, &udp->sock);
@@ -582,8 +629,12 @@ co_net_worker_set_tcp_send(
     bool enable
 )
 {
-    uint32_t flags =
-        (CO_SOCKET_EVENT_RECEIVE | CO_SOCKET_EVENT_CLOSE);
+    uint32_t flags = CO_SOCKET_EVENT_CLOSE;
+
+    if (!client->receive_paused)
+    {
+        flags |= CO_SOCKET_EVENT_RECEIVE;
+    }
 
     if (enable)
     {
@@ -605,13 +656,10 @@ co_net_worker_update_udp(
     co_udp_t* udp
 )
 {
-    if (net_worker->udps != NULL)
+    if (udp->sock.worker_it != NULL)
     {
-        if (co_list_contains(net_worker->udps, udp))
-        {
-            return co_net_selector_update(
-                net_worker->net_selector, &udp->sock, udp->sock_event_flags);
-        }
+        return co_net_selector_update(
+            net_worker->net_selector, &udp->sock, udp->sock_event_flags);
     }
 
     return co_net_worker_register_udp(net_worker, udp);
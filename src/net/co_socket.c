@@ -30,6 +30,7 @@ co_socket_setup(
     sock->remote.is_open = false;
 
     sock->timer = NULL;
+    sock->worker_it = NULL;
 
     sock->sub_class = NULL;
     sock->tls = NULL;
@@ -54,6 +55,7 @@ co_socket_cleanup(
 
     co_timer_destroy(sock->timer);
     sock->timer = NULL;
+    sock->worker_it = NULL;
 
     sock->sub_class = NULL;
     sock->tls = NULL;
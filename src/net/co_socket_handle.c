@@ -7,6 +7,14 @@
 #include <unistd.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/uio.h>
+#endif
+
+#ifdef CO_OS_LINUX
+#include <sys/sendfile.h>
+#elif defined(CO_OS_MAC)
+#include <sys/types.h>
+#include <sys/socket.h>
 #endif
 
 //---------------------------------------------------------------------------//
@@ -165,6 +173,68 @@ co_socket_handle_send(
     return result;
 }
 
+#ifndef CO_OS_WIN
+ssize_t
+co_socket_handle_send_vec(
+    co_socket_handle_t handle,
+    const co_buffer_st* buffers,
+    size_t buffer_count,
+    int flags
+)
+{
+    struct iovec iov[CO_SOCKET_MAX_SEND_VEC_COUNT];
+
+    if (buffer_count > CO_SOCKET_MAX_SEND_VEC_COUNT)
+    {
+        buffer_count = CO_SOCKET_MAX_SEND_VEC_COUNT;
+    }
+
+    for (size_t index = 0; index < buffer_count; ++index)
+    {
+        iov[index].iov_base = buffers[index].ptr;
+        iov[index].iov_len = buffers[index].size;
+    }
+
+    struct msghdr msg = { 0 };
+
+    msg.msg_iov = iov;
+    msg.msg_iovlen = buffer_count;
+
+#ifdef CO_OS_LINUX
+    flags |= MSG_NOSIGNAL;
+#endif
+    ssize_t result = sendmsg(handle, &msg, flags);
+
+    return result;
+}
+
+ssize_t
+co_socket_handle_send_file(
+    co_socket_handle_t handle,
+    int fd,
+    uint64_t offset,
+    size_t size
+)
+{
+#ifdef CO_OS_MAC
+    off_t length = (off_t)size;
+
+    // a partial send fails with EAGAIN but reports the sent length
+    if ((sendfile(fd, handle, (off_t)offset, &length, NULL, 0) == -1) &&
+        (length == 0))
+    {
+        return -1;
+    }
+
+    return (ssize_t)length;
+#else
+    off_t file_offset = (off_t)offset;
+
+    return sendfile(handle, fd, &file_offset, size);
+#endif
+}
+#endif // !CO_OS_WIN
+
 ssize_t
 co_socket_handle_receive(
     co_socket_handle_t handle,
@@ -289,6 +289,34 @@ co_socket_option_get_reuse_port(
 
 #endif // SO_REUSEPORT
 
+// SO_INCOMING_CPU
+
+#ifdef SO_INCOMING_CPU
+
+bool
+co_socket_option_set_incoming_cpu(
+    co_socket_t* sock,
+    int cpu
+)
+{
+    return co_socket_option_set(
+        sock, SOL_SOCKET, SO_INCOMING_CPU, &cpu, sizeof(cpu));
+}
+
+bool
+co_socket_option_get_incoming_cpu(
+    const co_socket_t* sock,
+    int* cpu
+)
+{
+    size_t value_size = sizeof(int);
+
+    return co_socket_option_get(
+        sock, SOL_SOCKET, SO_INCOMING_CPU, cpu, &value_size);
+}
+
+#endif // SO_INCOMING_CPU
+
 // IP_ADD_MEMBERSHIP
 
 bool
@@ -7,6 +7,7 @@
 
 #ifndef CO_OS_WIN
 #include <errno.h>
+#include <unistd.h>
 #endif
 
 //---------------------------------------------------------------------------//
@@ -73,11 +74,29 @@ co_tcp_client_setup(
 
     client->send_async_queue = NULL;
 
+    client->send_buffer.ptr = NULL;
+    client->send_buffer.index = 0;
+    client->send_buffer.low_watermark =
+        CO_TCP_SEND_BUFFER_DEFAULT_LOW_WATERMARK;
+    client->send_buffer.high_watermark =
+        CO_TCP_SEND_BUFFER_DEFAULT_HIGH_WATERMARK;
+    client->send_buffer.high = false;
+
+    client->send_file.fd = -1;
+    client->send_file.offset = 0;
+    client->send_file.size = 0;
+    client->send_file.preceding_size = 0;
+
+    client->receive_paused = false;
+    client->max_receive_all_size = SIZE_MAX;
+
     client->callbacks.on_connect = NULL;
     client->callbacks.on_send_async = NULL;
     client->callbacks.on_receive = NULL;
     client->callbacks.on_timer = NULL;
     client->callbacks.on_close = NULL;
+    client->callbacks.on_send_buffer_high = NULL;
+    client->callbacks.on_send_buffer_low = NULL;
 
     client->close_timer = NULL;
 
@@ -109,11 +128,30 @@ co_tcp_client_cleanup(
         client->send_async_queue = NULL;
     }
 
+    if (client->send_buffer.ptr != NULL)
+    {
+        co_byte_array_destroy(client->send_buffer.ptr);
+        client->send_buffer.ptr = NULL;
+    }
+
+    client->send_buffer.index = 0;
+    client->send_buffer.high = false;
+
+#ifndef CO_OS_WIN
+    if (client->send_file.fd != -1)
+    {
+        close(client->send_file.fd);
+        client->send_file.fd = -1;
+    }
+#endif
+
     client->callbacks.on_connect = NULL;
     client->callbacks.on_send_async = NULL;
     client->callbacks.on_receive = NULL;
     client->callbacks.on_timer = NULL;
     client->callbacks.on_close = NULL;
+    client->callbacks.on_send_buffer_high = NULL;
+    client->callbacks.on_send_buffer_low = NULL;
 
     co_socket_cleanup(&client->sock);
 }
@@ -182,6 +220,235 @@ co_tcp_client_on_connect_complete(
 }
 
 #ifndef CO_OS_WIN
+static bool
+co_tcp_client_add_send_buffer(
+    co_tcp_client_t* client,
+    const void* data,
+    size_t data_size
+)
+{
+    if (client->send_buffer.ptr == NULL)
+    {
+        client->send_buffer.ptr = co_byte_array_create();
+
+        if (client->send_buffer.ptr == NULL)
+        {
+            return false;
+        }
+    }
+
+    co_byte_array_add(client->send_buffer.ptr, data, data_size);
+
+    co_tcp_log_debug(
+        &client->sock.local.net_addr,
+        "-->",
+        &client->sock.remote.net_addr,
+        "tcp send BUFFERED %zd bytes", data_size);
+
+    size_t buffered_size = co_tcp_get_send_buffer_size(client);
+
+    if (!client->send_buffer.high &&
+        (buffered_size >= client->send_buffer.high_watermark))
+    {
+        client->send_buffer.high = true;
+
+        if (client->callbacks.on_send_buffer_high != NULL)
+        {
+            client->callbacks.on_send_buffer_high(
+                client->sock.owner_thread, client, buffered_size);
+        }
+    }
+
+    return true;
+}
+
+static void
+co_tcp_client_end_send_file(
+    co_tcp_client_t* client
+)
+{
+    if (client->send_file.fd != -1)
+    {
+        close(client->send_file.fd);
+
+        client->send_file.fd = -1;
+        client->send_file.offset = 0;
+        client->send_file.size = 0;
+        client->send_file.preceding_size = 0;
+    }
+}
+
+// returns false on a socket error, true when done or the socket is full
+static bool
+co_tcp_client_flush_send_file(
+    co_tcp_client_t* client
+)
+{
+    while (client->send_file.size > 0)
+    {
+        ssize_t sent_size = co_socket_handle_send_file(
+            client->sock.handle, client->send_file.fd,
+            client->send_file.offset, client->send_file.size);
+
+        if (sent_size <= 0)
+        {
+            int error_code = co_socket_get_error();
+
+            if ((sent_size < 0) &&
+                ((error_code == EAGAIN) || (error_code == EWOULDBLOCK)))
+            {
+                return true;
+            }
+
+            // an error, or the file became shorter than announced
+
+            co_tcp_log_error(
+                &client->sock.local.net_addr,
+                "-->",
+                &client->sock.remote.net_addr,
+                "tcp send file failed (%d)", error_code);
+
+            co_tcp_client_end_send_file(client);
+
+            return false;
+        }
+
+        client->send_file.offset += (uint64_t)sent_size;
+        client->send_file.size -= (size_t)sent_size;
+    }
+
+    co_tcp_log_debug(
+        &client->sock.local.net_addr,
+        "-->",
+        &client->sock.remote.net_addr,
+        "tcp send file completed");
+
+    co_tcp_client_end_send_file(client);
+
+    return true;
+}
+
+static bool
+co_tcp_client_flush_send_buffer(
+    co_tcp_client_t* client
+)
+{
+    size_t buffered_size = co_tcp_get_send_buffer_size(client);
+
+    for (;;)
+    {
+        // a pending file goes out after the bytes queued before it
+
+        size_t send_size = (client->send_file.fd != -1) ?
+            client->send_file.preceding_size : buffered_size;
+
+        while (send_size > 0)
+        {
+            ssize_t sent_size = co_socket_handle_send(
+                client->sock.handle,
+                co_byte_array_get_const_ptr(
+                    client->send_buffer.ptr, client->send_buffer.index),
+                send_size, 0);
+
+            if (sent_size <= 0)
+            {
+                int error_code = co_socket_get_error();
+
+                if ((error_code == EAGAIN) || (error_code == EWOULDBLOCK))
+                {
+                    break;
+                }
+
+                co_byte_array_clear(client->send_buffer.ptr);
+                client->send_buffer.index = 0;
+
+                co_tcp_client_end_send_file(client);
+
+                return false;
+            }
+
+            client->send_buffer.index += (size_t)sent_size;
+            buffered_size -= (size_t)sent_size;
+            send_size -= (size_t)sent_size;
+
+            if (client->send_file.fd != -1)
+            {
+                client->send_file.preceding_size -= (size_t)sent_size;
+            }
+        }
+
+        if ((send_size > 0) || (client->send_file.fd == -1))
+        {
+            break;
+        }
+
+        if (!co_tcp_client_flush_send_file(client))
+        {
+            return false;
+        }
+
+        if (client->send_file.fd != -1)
+        {
+            // the socket is full
+            break;
+        }
+    }
+
+    if (buffered_size == 0)
+    {
+        if (client->send_buffer.ptr != NULL)
+        {
+            co_byte_array_clear(client->send_buffer.ptr);
+        }
+
+        client->send_buffer.index = 0;
+    }
+    else if (client->send_buffer.index >= buffered_size)
+    {
+        // compact: the sent prefix is larger than the remaining tail
+
+        memmove(
+            co_byte_array_get_ptr(client->send_buffer.ptr, 0),
+            co_byte_array_get_ptr(
+                client->send_buffer.ptr, client->send_buffer.index),
+            buffered_size);
+
+        co_byte_array_set_count(client->send_buffer.ptr, buffered_size);
+        client->send_buffer.index = 0;
+    }
+
+    return true;
+}
+
+bool
+co_tcp_client_is_send_pending(
+    const co_tcp_client_t* client
+)
+{
+    return (co_tcp_get_send_buffer_size(client) > 0) ||
+        (client->send_file.fd != -1);
+}
+
+static bool
+co_tcp_client_update_events(
+    co_tcp_client_t* client
+)
+{
+    if (client->sock.worker_it == NULL)
+    {
+        return true;
+    }
+
+    // keeps EPOLLOUT as long as anything waits for it
+    const bool send_enabled =
+        co_tcp_client_is_send_pending(client) ||
+        ((client->send_async_queue != NULL) &&
+            (co_queue_get_count(client->send_async_queue) > 0));
+
+    return co_net_worker_set_tcp_send(
+        co_socket_get_net_worker(&client->sock), client, send_enabled);
+}
+
 void
 co_tcp_client_on_send_async_ready(
     co_tcp_client_t* client
@@ -192,8 +459,57 @@ co_tcp_client_on_send_async_ready(
         return;
     }
 
+    if (co_tcp_client_is_send_pending(client))
+    {
+        if (!co_tcp_client_flush_send_buffer(client))
+        {
+            return;
+        }
+
+        if (client->close_timer != NULL)
+        {
+            // the close timeout counts from the last progress
+            co_timer_stop(client->close_timer);
+            co_timer_start(client->close_timer);
+        }
+
+        size_t buffered_size = co_tcp_get_send_buffer_size(client);
+
+        if (client->send_buffer.high &&
+            (buffered_size <= client->send_buffer.low_watermark))
+        {
+            client->send_buffer.high = false;
+
+            if (client->callbacks.on_send_buffer_low != NULL)
+            {
+                client->callbacks.on_send_buffer_low(
+                    client->sock.owner_thread, client, buffered_size);
+
+                if (client->sock.handle == CO_SOCKET_INVALID_HANDLE)
+                {
+                    return;
+                }
+            }
+        }
+
+        if (co_tcp_client_is_send_pending(client))
+        {
+            return;
+        }
+
+        if (!client->sock.local.is_open)
+        {
+            // half close was deferred until the buffer drained
+
+            co_socket_handle_shutdown(
+                client->sock.handle, CO_SOCKET_SHUTDOWN_SEND);
+        }
+    }
+
     co_tcp_send_async_data_t* send_data =
-        (co_tcp_send_async_data_t*)co_queue_peek_head(client->send_async_queue);
+        (client->send_async_queue != NULL) ?
+            (co_tcp_send_async_data_t*)co_queue_peek_head(
+                client->send_async_queue) : NULL;
 
     if (send_data == NULL)
     {
@@ -275,6 +591,18 @@ co_tcp_client_on_receive_ready(
         return;
     }
 
+    if (client->receive_paused)
+    {
+#ifdef CO_OS_WIN
+        // kept for co_tcp_resume_receive
+        if (data_size > 0)
+        {
+            client->sock.win.client.receive.size = data_size;
+        }
+#endif
+        return;
+    }
+
     co_tcp_log_debug(
         &client->sock.local.net_addr,
         "<--",
@@ -299,7 +627,7 @@ co_tcp_client_on_receive_ready(
         client->sock.win.client.receive.size = 0;
     }
 
-    if (data_size > 0)
+    if ((data_size > 0) && !client->receive_paused)
     {
         if (client->sock.win.client.receive.size == 0)
         {
@@ -374,6 +702,24 @@ co_tcp_client_on_close(
     }
 }
 
+void
+co_tcp_client_continue_receive(
+    co_tcp_client_t* client
+)
+{
+#ifdef CO_OS_WIN
+    // the rest stays in the receive buffer, which is handled again
+    (void)client;
+#else
+    // edge triggered, no new event comes for the data left in the socket
+    co_thread_send_event(
+        client->sock.owner_thread,
+        CO_NET_EVENT_ID_TCP_RECEIVE_READY,
+        (uintptr_t)client,
+        0);
+#endif
+}
+
 //---------------------------------------------------------------------------//
 // public
 //---------------------------------------------------------------------------//
@@ -462,6 +808,8 @@ co_tcp_client_destroy(
         client->callbacks.on_receive = NULL;
         client->callbacks.on_timer = NULL;
         client->callbacks.on_close = NULL;
+        client->callbacks.on_send_buffer_high = NULL;
+        client->callbacks.on_send_buffer_low = NULL;
 
         co_net_worker_close_tcp_client_local(
             co_socket_get_net_worker(&client->sock),
@@ -550,19 +898,205 @@ co_tcp_send(
 
 #else
 
-    co_socket_handle_set_blocking(client->sock.handle, true);
+    if (co_tcp_client_is_send_pending(client))
+    {
+        // keep the byte order behind the data already waiting
+
+        return co_tcp_client_add_send_buffer(client, data, data_size);
+    }
 
     ssize_t sent_size =
         co_socket_handle_send(
             client->sock.handle, data, data_size, 0);
 
-    co_socket_handle_set_blocking(client->sock.handle, false);
+    if (sent_size < 0)
+    {
+        int error_code = co_socket_get_error();
+
+        if ((error_code != EAGAIN) && (error_code != EWOULDBLOCK))
+        {
+            return false;
+        }
+
+        sent_size = 0;
+    }
 
-    return (data_size == (size_t)sent_size);
+    if ((size_t)sent_size == data_size)
+    {
+        return true;
+    }
+
+    if (!co_tcp_client_add_send_buffer(client,
+        (const uint8_t*)data + sent_size, data_size - (size_t)sent_size))
+    {
+        return false;
+    }
+
+    return co_net_worker_set_tcp_send(
+        co_socket_get_net_worker(&client->sock), client, true);
 
 #endif
 }
 
+bool
+co_tcp_send_vec(
+    co_tcp_client_t* client,
+    const co_buffer_st* buffers,
+    size_t buffer_count
+)
+{
+    for (size_t index = 0; index < buffer_count; ++index)
+    {
+        co_tcp_log_debug_hex_dump(
+            &client->sock.local.net_addr,
+            "-->",
+            &client->sock.remote.net_addr,
+            buffers[index].ptr, buffers[index].size,
+            "tcp send %zd bytes", buffers[index].size);
+    }
+
+#ifdef CO_OS_WIN
+
+    for (size_t index = 0; index < buffer_count; ++index)
+    {
+        if (!co_win_net_send(&client->sock,
+            buffers[index].ptr, buffers[index].size))
+        {
+            return false;
+        }
+    }
+
+    return true;
+
+#else
+
+    size_t index = 0;
+    size_t offset = 0;
+
+    if (!co_tcp_client_is_send_pending(client))
+    {
+        while (index < buffer_count)
+        {
+            ssize_t sent_size = co_socket_handle_send_vec(
+                client->sock.handle,
+                &buffers[index], buffer_count - index, 0);
+
+            if (sent_size <= 0)
+            {
+                int error_code = co_socket_get_error();
+
+                if ((sent_size < 0) &&
+                    (error_code != EAGAIN) && (error_code != EWOULDBLOCK))
+                {
+                    return false;
+                }
+
+                break;
+            }
+
+            size_t remaining_size = (size_t)sent_size;
+
+            while ((index < buffer_count) &&
+                (remaining_size >= buffers[index].size))
+            {
+                remaining_size -= buffers[index].size;
+                ++index;
+            }
+
+            if (remaining_size > 0)
+            {
+                offset = remaining_size;
+
+                break;
+            }
+        }
+
+        if (index == buffer_count)
+        {
+            return true;
+        }
+    }
+
+    bool armed = co_tcp_client_is_send_pending(client);
+
+    for (; index < buffer_count; ++index)
+    {
+        if (!co_tcp_client_add_send_buffer(client,
+            (const uint8_t*)buffers[index].ptr + offset,
+            buffers[index].size - offset))
+        {
+            return false;
+        }
+
+        offset = 0;
+    }
+
+    if (armed)
+    {
+        return true;
+    }
+
+    return co_net_worker_set_tcp_send(
+        co_socket_get_net_worker(&client->sock), client, true);
+
+#endif
+}
+
+#ifndef CO_OS_WIN
+bool
+co_tcp_send_file(
+    co_tcp_client_t* client,
+    int fd,
+    uint64_t offset,
+    size_t size
+)
+{
+    if (client->send_file.fd != -1)
+    {
+        return false;
+    }
+
+    co_tcp_log_debug(
+        &client->sock.local.net_addr,
+        "-->",
+        &client->sock.remote.net_addr,
+        "tcp send file %zd bytes", size);
+
+    bool armed = co_tcp_client_is_send_pending(client);
+
+    client->send_file.fd = fd;
+    client->send_file.offset = offset;
+    client->send_file.size = size;
+    client->send_file.preceding_size = co_tcp_get_send_buffer_size(client);
+
+    if (armed)
+    {
+        return true;
+    }
+
+    if (!co_tcp_client_flush_send_file(client))
+    {
+        return false;
+    }
+
+    if (client->send_file.fd == -1)
+    {
+        return true;
+    }
+
+    return co_net_worker_set_tcp_send(
+        co_socket_get_net_worker(&client->sock), client, true);
+}
+
+bool
+co_tcp_is_sending_file(
+    const co_tcp_client_t* client
+)
+{
+    return (client->send_file.fd != -1);
+}
+#endif
+
 bool
 co_tcp_send_async(
     co_tcp_client_t* client,
@@ -608,6 +1142,23 @@ co_tcp_send_async(
 
 #else
 
+    if (co_tcp_client_is_send_pending(client))
+    {
+        // the buffered data and file go out first, the async queue
+        // is sent after them when the socket is writable
+
+        co_net_worker_set_tcp_send(
+            co_socket_get_net_worker(&client->sock), client, true);
+
+        co_tcp_log_debug(
+            &client->sock.local.net_addr,
+            "-->",
+            &client->sock.remote.net_addr,
+            "tcp send async QUEUED %d bytes", data_size);
+
+        return true;
+    }
+
     if (co_queue_get_count(client->send_async_queue) > 1)
     {
         co_tcp_log_debug(
@@ -658,6 +1209,31 @@ co_tcp_send_async(
     return false;
 }
 
+void
+co_tcp_set_send_buffer_watermark(
+    co_tcp_client_t* client,
+    size_t low_watermark,
+    size_t high_watermark
+)
+{
+    client->send_buffer.low_watermark = low_watermark;
+    client->send_buffer.high_watermark = high_watermark;
+}
+
+size_t
+co_tcp_get_send_buffer_size(
+    const co_tcp_client_t* client
+)
+{
+    if (client->send_buffer.ptr == NULL)
+    {
+        return 0;
+    }
+
+    return co_byte_array_get_count(
+        client->send_buffer.ptr) - client->send_buffer.index;
+}
+
 ssize_t
 co_tcp_receive(
     co_tcp_client_t* client,
@@ -706,17 +1282,43 @@ co_tcp_receive_all(
 
     for (;;)
     {
-        char buffer[8192];
+        if ((size_t)total >= client->max_receive_all_size)
+        {
+            co_tcp_client_continue_receive(client);
 
-        ssize_t size =
-            co_tcp_receive(client, buffer, sizeof(buffer));
+            break;
+        }
 
-        if (size <= 0)
+        // reads straight into the spare capacity of the array
+        const size_t count = co_byte_array_get_count(byte_array);
+        size_t free_size =
+            co_byte_array_get_capacity(byte_array) - count - 1;
+
+        if (free_size > (client->max_receive_all_size - (size_t)total))
+        {
+            free_size = client->max_receive_all_size - (size_t)total;
+        }
+
+        if (free_size < CO_TCP_RECEIVE_ALL_MIN_SIZE)
+        {
+            free_size = CO_TCP_RECEIVE_ALL_MIN_SIZE;
+        }
+
+        if (!co_byte_array_set_count(byte_array, count + free_size))
         {
             break;
         }
 
-        co_byte_array_add(byte_array, buffer, size);
+        ssize_t size = co_tcp_receive(client,
+            co_byte_array_get_ptr(byte_array, count), free_size);
+
+        co_byte_array_set_count(
+            byte_array, count + ((size > 0) ? (size_t)size : 0));
+
+        if (size <= 0)
+        {
+            break;
+        }
 
         total += size;
     }
@@ -724,6 +1326,84 @@ co_tcp_receive_all(
     return total;
 }
 
+void
+co_tcp_pause_receive(
+    co_tcp_client_t* client
+)
+{
+    if (client->receive_paused)
+    {
+        return;
+    }
+
+    co_tcp_log_debug(
+        &client->sock.local.net_addr,
+        NULL,
+        &client->sock.remote.net_addr,
+        "tcp receive paused");
+
+    client->receive_paused = true;
+
+#ifndef CO_OS_WIN
+    co_tcp_client_update_events(client);
+#endif
+}
+
+void
+co_tcp_resume_receive(
+    co_tcp_client_t* client
+)
+{
+    if (!client->receive_paused)
+    {
+        return;
+    }
+
+    co_tcp_log_debug(
+        &client->sock.local.net_addr,
+        NULL,
+        &client->sock.remote.net_addr,
+        "tcp receive resumed");
+
+    client->receive_paused = false;
+
+#ifdef CO_OS_WIN
+    const size_t data_size = client->sock.win.client.receive.size;
+
+    if (data_size == 0)
+    {
+        co_win_net_receive_start(&client->sock);
+    }
+#else
+    const size_t data_size = 0;
+
+    co_tcp_client_update_events(client);
+#endif
+
+    co_thread_send_event(
+        client->sock.owner_thread,
+        CO_NET_EVENT_ID_TCP_RECEIVE_READY,
+        (uintptr_t)client,
+        data_size);
+}
+
+bool
+co_tcp_is_receive_paused(
+    const co_tcp_client_t* client
+)
+{
+    return client->receive_paused;
+}
+
+void
+co_tcp_set_max_receive_all_size(
+    co_tcp_client_t* client,
+    size_t max_size
+)
+{
+    client->max_receive_all_size = max_size;
+}
+
 co_tcp_callbacks_st*
 co_tcp_get_callbacks(
     co_tcp_client_t* client
@@ -748,6 +1428,73 @@ co_tcp_half_close(
         client, timeout_msec);
 }
 
+#ifndef CO_OS_WIN
+static void
+co_tcp_client_linger(
+    co_tcp_client_t* client
+)
+{
+    // the socket and the data still to be sent move to a detached
+    // client, which shuts down the sending side when the data is out
+    // and closes with the peer or on the close timer
+
+    co_tcp_client_t* linger = co_tcp_client_create_with(
+        client->sock.handle, &client->sock.remote.net_addr);
+
+    if (linger == NULL)
+    {
+        co_tcp_log_error(
+            &client->sock.local.net_addr,
+            "-->",
+            &client->sock.remote.net_addr,
+            "tcp close dropped %zd buffered bytes",
+            co_tcp_get_send_buffer_size(client));
+
+        return;
+    }
+
+    co_net_worker_t* net_worker = co_socket_get_net_worker(&client->sock);
+
+    co_net_worker_unregister_tcp_connection(net_worker, client);
+
+    linger->sock.owner_thread = client->sock.owner_thread;
+
+    linger->send_buffer.ptr = client->send_buffer.ptr;
+    linger->send_buffer.index = client->send_buffer.index;
+    linger->send_file = client->send_file;
+
+    client->send_buffer.ptr = NULL;
+    client->send_buffer.index = 0;
+    client->send_file.fd = -1;
+    client->send_file.offset = 0;
+    client->send_file.size = 0;
+    client->send_file.preceding_size = 0;
+
+    // the rest of the close skips the moved handle
+    client->sock.handle = CO_SOCKET_INVALID_HANDLE;
+
+    if (!co_net_worker_register_tcp_connection(net_worker, linger) ||
+        !co_net_worker_set_tcp_send(net_worker, linger, true) ||
+        !co_net_worker_close_tcp_client_local(
+            net_worker, linger, CO_TCP_CLOSE_LINGER_TIMEOUT))
+    {
+        co_tcp_log_error(
+            &linger->sock.local.net_addr,
+            "-->",
+            &linger->sock.remote.net_addr,
+            "tcp close dropped %zd buffered bytes",
+            co_tcp_get_send_buffer_size(linger));
+
+        co_net_worker_unregister_tcp_connection(net_worker, linger);
+
+        linger->sock.local.is_open = false;
+        linger->sock.remote.is_open = false;
+    }
+
+    co_tcp_client_destroy(linger);
+}
+#endif
+
 void
 co_tcp_close(
     co_tcp_client_t* client
@@ -763,6 +1510,19 @@ co_tcp_close(
         return;
     }
 
+#ifndef CO_OS_WIN
+    if (client->sock.worker_it != NULL)
+    {
+        // last non-blocking attempt for the buffered data
+        co_tcp_client_flush_send_buffer(client);
+
+        if (co_tcp_client_is_send_pending(client))
+        {
+            co_tcp_client_linger(client);
+        }
+    }
+#endif
+
     if (client->sock.owner_thread != NULL)
     {
         co_net_worker_unregister_tcp_connection(
@@ -774,6 +1534,8 @@ co_tcp_close(
     client->callbacks.on_receive = NULL;
     client->callbacks.on_timer = NULL;
     client->callbacks.on_close = NULL;
+    client->callbacks.on_send_buffer_high = NULL;
+    client->callbacks.on_send_buffer_low = NULL;
 
     co_socket_handle_close(client->sock.handle);
     client->sock.handle = CO_SOCKET_INVALID_HANDLE;
@@ -5,6 +5,7 @@
 #include <coldforce/net/co_net_worker.h>
 #include <coldforce/net/co_net_event.h>
 #include <coldforce/net/co_net_log.h>
+#include <coldforce/net/co_socket_option.h>
 
 //---------------------------------------------------------------------------//
 // tcp server
@@ -236,6 +237,51 @@ co_tcp_server_start(
     return true;
 }
 
+bool
+co_tcp_server_start_shared(
+    co_tcp_server_t* server,
+    int backlog,
+    int incoming_cpu
+)
+{
+#ifdef SO_REUSEPORT
+
+    if (server->sock.handle == CO_SOCKET_INVALID_HANDLE)
+    {
+        return false;
+    }
+
+    // each net thread listens on its own socket bound to the same
+    // address, and the kernel distributes incoming connections
+
+    if (!co_socket_option_set_reuse_port(&server->sock, true))
+    {
+        return false;
+    }
+
+#ifdef SO_INCOMING_CPU
+    if (incoming_cpu != CO_TCP_SERVER_INCOMING_CPU_ANY)
+    {
+        // only a hint, ignore failure
+        co_socket_option_set_incoming_cpu(&server->sock, incoming_cpu);
+    }
+#else
+    (void)incoming_cpu;
+#endif
+
+    return co_tcp_server_start(server, backlog);
+
+#else
+
+    (void)server;
+    (void)backlog;
+    (void)incoming_cpu;
+
+    return false;
+
+#endif // SO_REUSEPORT
+}
+
 void
 co_tcp_server_close (
     co_tcp_server_t* server
@@ -470,7 +470,7 @@ co_tls_encrypt_data(
     co_tls_client_t* tls = (co_tls_client_t*)sock->tls;
 
     size_t plain_index = 0;
-    size_t enc_index = 0;
+    size_t enc_index = co_byte_array_get_count(enc_data);
 
     for (;;)
     {
@@ -484,14 +484,33 @@ co_tls_encrypt_data(
             {
                 plain_index += (size_t)ssl_result;
             }
+            else
+            {
+                int ssl_error = SSL_get_error(tls->ssl, ssl_result);
+
+                if ((ssl_error != SSL_ERROR_WANT_READ) &&
+                    (ssl_error != SSL_ERROR_WANT_WRITE))
+                {
+                    co_tls_log_error(
+                        &sock->local.net_addr,
+                        "-->",
+                        &sock->remote.net_addr,
+                        "tls send error: (%d)", ssl_error);
+
+                    return false;
+                }
+            }
         }
 
         size_t pending_size = BIO_ctrl_pending(tls->network_bio);
 
         if (pending_size > 0)
         {
-            co_byte_array_set_count(enc_data,
-                co_byte_array_get_count(enc_data) + pending_size);
+            if (!co_byte_array_set_count(enc_data,
+                co_byte_array_get_count(enc_data) + pending_size))
+            {
+                return false;
+            }
         }
         else
         {
@@ -11,6 +11,32 @@
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
+#ifdef CO_USE_TLS
+static bool
+co_tls_tcp_fail_send(
+    co_tcp_client_t* tcp_client
+)
+{
+    co_tls_client_t* tls =
+        (co_tls_client_t*)tcp_client->sock.tls;
+
+    // ssl has already taken the data of the records encrypted so
+    // far. they go out, then the connection closes, since the rest
+    // of the tls stream can no longer follow them
+
+    if (co_byte_array_get_count(tls->send_data) > 0)
+    {
+        co_tcp_send(tcp_client,
+            co_byte_array_get_ptr(tls->send_data, 0),
+            co_byte_array_get_count(tls->send_data));
+    }
+
+    co_tcp_half_close(tcp_client, CO_TCP_CLOSE_LINGER_TIMEOUT);
+
+    return false;
+}
+#endif // CO_USE_TLS
+
 //---------------------------------------------------------------------------//
 // public
 //---------------------------------------------------------------------------//
@@ -220,17 +246,15 @@ co_tls_tcp_send(
 
     co_byte_array_clear(tls->send_data);
 
-    bool result = false;
-
-    if (co_tls_encrypt_data(
+    if (!co_tls_encrypt_data(
         &tcp_client->sock, data, data_size, tls->send_data))
     {
-        result = co_tcp_send(tcp_client,
-            co_byte_array_get_ptr(tls->send_data, 0),
-            co_byte_array_get_count(tls->send_data));
+        return co_tls_tcp_fail_send(tcp_client);
     }
-    
-    return result;
+
+    return co_tcp_send(tcp_client,
+        co_byte_array_get_ptr(tls->send_data, 0),
+        co_byte_array_get_count(tls->send_data));
 
 #else
 
@@ -243,6 +267,107 @@ co_tls_tcp_send(
 #endif // CO_USE_TLS
 }
 
+bool
+co_tls_tcp_send_vec(
+    co_tcp_client_t* tcp_client,
+    const co_buffer_st* buffers,
+    size_t buffer_count
+)
+{
+#ifdef CO_USE_TLS
+
+    co_tls_client_t* tls =
+        (co_tls_client_t*)tcp_client->sock.tls;
+
+    co_byte_array_clear(tls->send_data);
+
+    // small buffers (frame and message headers) are gathered so that
+    // they do not each become a tls record of their own
+
+    co_byte_array_t* plain_data = NULL;
+    bool result = true;
+
+    for (size_t index = 0;
+        result && (index < buffer_count);
+        ++index)
+    {
+        co_tls_log_debug_hex_dump(
+            &tcp_client->sock.local.net_addr,
+            "-->",
+            &tcp_client->sock.remote.net_addr,
+            buffers[index].ptr, buffers[index].size,
+            "tls send %zd bytes", buffers[index].size);
+
+        if (buffers[index].size < CO_TLS_SEND_VEC_GATHER_SIZE)
+        {
+            if (plain_data == NULL)
+            {
+                plain_data = co_byte_array_create();
+
+                if (plain_data == NULL)
+                {
+                    result = false;
+
+                    break;
+                }
+            }
+
+            co_byte_array_add(plain_data,
+                buffers[index].ptr, buffers[index].size);
+
+            continue;
+        }
+
+        if ((plain_data != NULL) &&
+            (co_byte_array_get_count(plain_data) > 0))
+        {
+            result = co_tls_encrypt_data(&tcp_client->sock,
+                co_byte_array_get_ptr(plain_data, 0),
+                co_byte_array_get_count(plain_data),
+                tls->send_data);
+
+            co_byte_array_clear(plain_data);
+        }
+
+        result = result &&
+            co_tls_encrypt_data(&tcp_client->sock,
+                buffers[index].ptr, buffers[index].size,
+                tls->send_data);
+    }
+
+    if (plain_data != NULL)
+    {
+        if (result && (co_byte_array_get_count(plain_data) > 0))
+        {
+            result = co_tls_encrypt_data(&tcp_client->sock,
+                co_byte_array_get_ptr(plain_data, 0),
+                co_byte_array_get_count(plain_data),
+                tls->send_data);
+        }
+
+        co_byte_array_destroy(plain_data);
+    }
+
+    if (!result)
+    {
+        return co_tls_tcp_fail_send(tcp_client);
+    }
+
+    return co_tcp_send(tcp_client,
+        co_byte_array_get_ptr(tls->send_data, 0),
+        co_byte_array_get_count(tls->send_data));
+
+#else
+
+    (void)tcp_client;
+    (void)buffers;
+    (void)buffer_count;
+
+    return false;
+
+#endif // CO_USE_TLS
+}
+
 bool
 co_tls_tcp_send_async(
     co_tcp_client_t* tcp_client,
@@ -265,18 +390,16 @@ co_tls_tcp_send_async(
 
     co_byte_array_clear(tls->send_data);
 
-    bool result = false;
-
-    if (co_tls_encrypt_data(
+    if (!co_tls_encrypt_data(
         &tcp_client->sock, data, data_size, tls->send_data))
     {
-        result = co_tcp_send_async(tcp_client,
-            co_byte_array_get_ptr(tls->send_data, 0),
-            co_byte_array_get_count(tls->send_data),
-            user_data);
+        return co_tls_tcp_fail_send(tcp_client);
     }
 
-    return result;
+    return co_tcp_send_async(tcp_client,
+        co_byte_array_get_ptr(tls->send_data, 0),
+        co_byte_array_get_count(tls->send_data),
+        user_data);
 
 #else
 
@@ -371,12 +494,29 @@ co_tls_tcp_receive_all(
     size_t array_size_before =
         co_byte_array_get_count(byte_array);
 
+    size_t enc_total_size = 0;
+
     for (;;)
     {
         uint8_t buffer[8192];
 
-        ssize_t enc_data_size =
-            co_tcp_receive(tcp_client, buffer, sizeof(buffer));
+        ssize_t enc_data_size = 0;
+
+        if (enc_total_size < tcp_client->max_receive_all_size)
+        {
+            enc_data_size =
+                co_tcp_receive(tcp_client, buffer, sizeof(buffer));
+
+            if (enc_data_size > 0)
+            {
+                enc_total_size += (size_t)enc_data_size;
+
+                if (enc_total_size >= tcp_client->max_receive_all_size)
+                {
+                    co_tcp_client_continue_receive(tcp_client);
+                }
+            }
+        }
 
         if (enc_data_size > 0)
         {
@@ -384,22 +524,32 @@ co_tls_tcp_receive_all(
                 tls->receive_data_queue, buffer, enc_data_size);
         }
 
+        // decrypts straight into the spare capacity of the array
+        const size_t count = co_byte_array_get_count(byte_array);
+        size_t free_size =
+            co_byte_array_get_capacity(byte_array) - count - 1;
+
+        if (free_size < CO_TCP_RECEIVE_ALL_MIN_SIZE)
+        {
+            free_size = CO_TCP_RECEIVE_ALL_MIN_SIZE;
+        }
+
+        if (!co_byte_array_set_count(byte_array, count + free_size))
+        {
+            break;
+        }
+
         ssize_t plain_data_size =
             co_tls_decrypt_data(&tcp_client->sock,
                 tls->receive_data_queue,
-                buffer, sizeof(buffer));
+                co_byte_array_get_ptr(byte_array, count), free_size);
 
-        if (plain_data_size <= 0)
-        {
-            if (enc_data_size <= 0)
-            {
-                break;
-            }
-        }
-        else
+        co_byte_array_set_count(byte_array,
+            count + ((plain_data_size > 0) ? (size_t)plain_data_size : 0));
+
+        if ((plain_data_size <= 0) && (enc_data_size <= 0))
         {
-            co_byte_array_add(
-                byte_array, buffer, plain_data_size);
+            break;
         }
     }
     
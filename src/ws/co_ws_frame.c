@@ -1,6 +1,7 @@
 #include <coldforce/core/co_std.h>
 #include <coldforce/core/co_byte_array.h>
 #include <coldforce/core/co_random.h>
+#include <coldforce/core/co_mem_pool.h>
 
 #include <coldforce/net/co_byte_order.h>
 
@@ -256,7 +257,7 @@ co_ws_frame_create(
 )
 {
     co_ws_frame_t* frame =
-        (co_ws_frame_t*)co_mem_alloc(sizeof(co_ws_frame_t));
+        (co_ws_frame_t*)co_mem_pool_alloc(sizeof(co_ws_frame_t));
 
     if (frame == NULL)
     {
@@ -283,7 +284,7 @@ co_ws_frame_destroy(
             co_mem_free(frame->payload_data);
         }
 
-        co_mem_free(frame);
+        co_mem_pool_free(frame);
     }
 }
 
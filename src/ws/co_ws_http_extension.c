@@ -112,7 +112,7 @@ co_http_request_validate_ws_upgrade(
         co_http_request_get_const_header(request);
 
     const char* upgrade =
-        co_http_header_get_field(header, CO_HTTP_HEADER_UPGRADE);
+        co_http_header_get_field_by_id(header, CO_HTTP_HEADER_ID_UPGRADE);
 
     if (upgrade == NULL)
     {
@@ -125,7 +125,7 @@ co_http_request_validate_ws_upgrade(
     }
 
     const char* connection =
-        co_http_header_get_field(header, CO_HTTP_HEADER_CONNECTION);
+        co_http_header_get_field_by_id(header, CO_HTTP_HEADER_ID_CONNECTION);
 
     if (connection == NULL)
     {
@@ -195,7 +195,7 @@ co_http_response_validate_ws_upgrade(
         co_http_response_get_const_header(response);
 
     const char* upgrade =
-        co_http_header_get_field(header, CO_HTTP_HEADER_UPGRADE);
+        co_http_header_get_field_by_id(header, CO_HTTP_HEADER_ID_UPGRADE);
 
     if (upgrade == NULL)
     {
@@ -208,7 +208,7 @@ co_http_response_validate_ws_upgrade(
     }
 
     const char* connection =
-        co_http_header_get_field(header, CO_HTTP_HEADER_CONNECTION);
+        co_http_header_get_field_by_id(header, CO_HTTP_HEADER_ID_CONNECTION);
 
     if (connection == NULL)
     {
@@ -92,9 +92,7 @@ co_ws_server_on_tcp_receive_ready(
         (co_ws_client_t*)tcp_client->sock.sub_class;
 
     ssize_t receive_result =
-        client->conn.module.receive_all(
-            client->conn.tcp_client,
-            client->conn.receive_data.ptr);
+        co_http_connection_receive(&client->conn);
 
     if (receive_result <= 0)
     {
@@ -168,6 +166,5 @@ co_ws_server_on_tcp_receive_ready(
         }
     }
 
-    client->conn.receive_data.index = 0;
-    co_byte_array_clear(client->conn.receive_data.ptr);
+    co_http_connection_clear_receive_data(&client->conn);
 }